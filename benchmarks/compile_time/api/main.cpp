@@ -0,0 +1,89 @@
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <boost/preprocessor/stringize.hpp>
+#include <stress_class.hpp>
+
+#define COUSCOUS_BENCH_API_NONE 0         /**< only class definition */
+#define COUSCOUS_BENCH_API_TABLES 1       /**< names and metadata tables */
+#define COUSCOUS_BENCH_API_COUNT 2        /**< reflect::utils::count */
+#define COUSCOUS_BENCH_API_MEMBER_NAME 3  /**< reflect::utils::member_name */
+#define COUSCOUS_BENCH_API_FIND_BY_NAME 4 /**< reflect::utils::find_by_name */
+#define COUSCOUS_BENCH_API_INVOKE 5       /**< reflect::utils::invoke */
+#define COUSCOUS_BENCH_API_FOR_EACH 6     /**< reflect::metautils::for_each */
+
+#ifndef COUSCOUS_BENCH_API
+#define COUSCOUS_BENCH_API COUSCOUS_BENCH_API_NONE /**< measured API */
+#endif
+
+#ifndef COUSCOUS_BENCH_ACCESSES
+#define COUSCOUS_BENCH_ACCESSES                                                \
+  COUSCOUS_BENCH_MEMBERS /**< amount of accessed variables */
+#endif
+
+constexpr long long reflected_count =
+    COUSCOUS_BENCH_MEMBERS + COUSCOUS_BENCH_METHODS * COUSCOUS_BENCH_OVERLOADS +
+    COUSCOUS_BENCH_DEPTH *
+        COUSCOUS_BENCH_LEVEL_MEMBERS; /**< amount of reflected elements */
+
+/**
+ * @brief Gets name of variable i
+ */
+#define COUSCOUS_BENCH_MEMBER_NAME(_, i, __)                                   \
+  sum += decltype(::boost::hana::size(                                         \
+      reflect::utils::member_name<StressClass, reflect::ObjVars>(              \
+          ::boost::hana::llong_c<i>)))::value;
+
+/**
+ * @brief Finds variable var<i> by its name
+ */
+#define COUSCOUS_BENCH_FIND_BY_NAME(_, i, __)                                  \
+  sum += reflect::utils::find_by_name_first<StressClass>(                      \
+      HANA_STR("var" BOOST_PP_STRINGIZE(i)));
+
+/**
+ * @brief Reads variable i
+ */
+#define COUSCOUS_BENCH_INVOKE_VAR(_, i, obj)                                   \
+  sum += reflect::utils::invoke<StressClass, reflect::ObjVars>(                \
+      ::boost::hana::llong_c<i>, obj);
+
+/**
+ * @brief Calls overload without arguments of method mtd<i>
+ */
+#define COUSCOUS_BENCH_INVOKE_METHOD(_, i, obj)                                \
+  sum += reflect::utils::invoke<StressClass, reflect::AllMethods>(             \
+      ::boost::hana::llong_c<i * COUSCOUS_BENCH_OVERLOADS>, obj);
+
+int main() {
+  StressClass obj;
+  long long sum = 0;
+#if COUSCOUS_BENCH_API == COUSCOUS_BENCH_API_TABLES
+  static_assert(decltype(::boost::hana::size(
+                    reflect::utils::MetaClass<StressClass>::names))::value ==
+                reflected_count);
+  static_assert(decltype(::boost::hana::size(
+                    reflect::utils::MetaClass<StressClass>::metadata))::value ==
+                reflected_count);
+#elif COUSCOUS_BENCH_API == COUSCOUS_BENCH_API_COUNT
+  static_assert(reflect::utils::count<StressClass>() == reflected_count);
+  sum += reflect::utils::count<StressClass, reflect::AllVars>();
+  sum += reflect::utils::count<StressClass, reflect::ObjVars>();
+  sum += reflect::utils::count<StressClass, reflect::AllMethods>();
+#elif COUSCOUS_BENCH_API == COUSCOUS_BENCH_API_MEMBER_NAME
+  BOOST_PP_REPEAT(COUSCOUS_BENCH_ACCESSES, COUSCOUS_BENCH_MEMBER_NAME, _)
+#elif COUSCOUS_BENCH_API == COUSCOUS_BENCH_API_FIND_BY_NAME
+  BOOST_PP_REPEAT(COUSCOUS_BENCH_ACCESSES, COUSCOUS_BENCH_FIND_BY_NAME, _)
+#elif COUSCOUS_BENCH_API == COUSCOUS_BENCH_API_INVOKE
+  BOOST_PP_REPEAT(COUSCOUS_BENCH_ACCESSES, COUSCOUS_BENCH_INVOKE_VAR, obj)
+  BOOST_PP_REPEAT(COUSCOUS_BENCH_METHODS, COUSCOUS_BENCH_INVOKE_METHOD, obj)
+#elif COUSCOUS_BENCH_API == COUSCOUS_BENCH_API_FOR_EACH
+  reflect::metautils::for_each(
+      reflect::metautils::gen_inds_tup<decltype(
+          reflect::utils::count<StressClass>())>(),
+      [&sum](auto &&index) {
+        sum += decltype(::boost::hana::size(
+            reflect::utils::member_name<StressClass>(index)))::value;
+        return 0;
+      });
+#endif
+  return sum == -1;
+}
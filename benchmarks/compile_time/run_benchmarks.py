@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+"""Compile-time benchmarks of ideal couscous.
+
+Compiles api/main.cpp for every combination of stress class size, inheritance
+depth and measured API, and writes a JSON report with compile time, peak
+compiler memory and template instantiation counts. Two reports can be compared
+with --compare.
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import signal
+import sys
+import threading
+import time
+
+ROOT = os.path.dirname(os.path.abspath(__file__))
+SRC = os.path.normpath(os.path.join(ROOT, "..", "..", "src"))
+MAIN = os.path.join(ROOT, "api", "main.cpp")
+
+APIS = ["none", "tables", "count", "member_name", "find_by_name", "invoke",
+        "for_each"]
+
+SPECIALIZATIONS = re.compile(
+    r"^(?:decl|type)_specializations: size \d+, (\d+) elements", re.M)
+
+
+def int_list(value):
+    return [int(item) for item in value.split(",") if item]
+
+
+def api_list(value):
+    apis = [item for item in value.split(",") if item]
+    unknown = set(apis) - set(APIS)
+    if unknown:
+        raise argparse.ArgumentTypeError(
+            "unknown API: " + ", ".join(sorted(unknown)))
+    return apis
+
+
+def compiler_info(cxx):
+    version = subprocess.run([cxx, "--version"], stdout=subprocess.PIPE,
+                             universal_newlines=True, check=True).stdout
+    first_line = version.splitlines()[0] if version else ""
+    return {"command": cxx, "version": first_line,
+            "gcc": "clang" not in version.lower() and (
+                "g++" in version or "gcc" in version.lower())}
+
+
+def command_line(args, compiler, config):
+    command = [args.cxx, "-std=" + args.std, "-I" + SRC, "-I" + ROOT,
+               "-Wno-non-template-friend" if compiler["gcc"] else "-w"]
+    command += ["-DCOUSCOUS_BENCH_API=%d" % APIS.index(config["api"]),
+                "-DCOUSCOUS_BENCH_MEMBERS=%d" % config["members"],
+                "-DCOUSCOUS_BENCH_METHODS=%d" % config["methods"],
+                "-DCOUSCOUS_BENCH_OVERLOADS=%d" % config["overloads"],
+                "-DCOUSCOUS_BENCH_DEPTH=%d" % config["depth"]]
+    return command + args.cxxflags
+
+
+def compile_once(args, compiler, config):
+    command = command_line(args, compiler, config)
+    if args.syntax_only:
+        command.append("-fsyntax-only")
+    else:
+        command += ["-c", "-o", os.devnull]
+    command.append(MAIN)
+
+    start = time.perf_counter()
+    process = subprocess.Popen(command, stdout=subprocess.DEVNULL,
+                               stderr=subprocess.PIPE,
+                               universal_newlines=True,
+                               start_new_session=True)
+    # compiler driver runs compiler proper as child, so whole group is killed
+    timer = threading.Timer(args.timeout, os.killpg,
+                            (process.pid, signal.SIGKILL))
+    timer.start()
+    stderr = process.stderr.read()
+    # on Linux wait4 usage covers compiler driver and compiler proper it
+    # waited for, so ru_maxrss is peak of them
+    _, status, usage = os.wait4(process.pid, 0)
+    wall = time.perf_counter() - start
+    timer.cancel()
+    process.returncode = (os.WEXITSTATUS(status)
+                          if os.WIFEXITED(status) else -1)
+
+    result = {"ok": process.returncode == 0,
+              "wall_s": round(wall, 3),
+              "peak_rss_kib": usage.ru_maxrss}
+    if wall >= args.timeout:
+        result["error"] = "timeout"
+        result["peak_rss_kib"] = None
+    elif process.returncode != 0:
+        result["error"] = "\n".join(
+            line for line in stderr.splitlines() if "error" in line)[:2000]
+    return result
+
+
+def count_instantiations(args, compiler, config):
+    """Counts function and class template specializations created by GCC.
+
+    -fstats slows compilation down, so it is done in separate run.
+    """
+    if not compiler["gcc"]:
+        return None
+    command = command_line(args, compiler, config)
+    command += ["-fsyntax-only", "-fstats", MAIN]
+    process = subprocess.run(command, stdout=subprocess.DEVNULL,
+                             stderr=subprocess.PIPE,
+                             universal_newlines=True)
+    counts = SPECIALIZATIONS.findall(process.stderr)
+    return sum(int(count) for count in counts) if counts else None
+
+
+def measure(args, compiler, config):
+    runs = [compile_once(args, compiler, config) for _ in range(args.repeat)]
+    failed = [run for run in runs if not run["ok"]]
+    if failed:
+        return failed[0]
+    best = min(runs, key=lambda run: run["wall_s"])
+    best["peak_rss_kib"] = max(run["peak_rss_kib"] for run in runs)
+    best["instantiations"] = (count_instantiations(args, compiler, config)
+                              if args.instantiations else None)
+    return best
+
+
+def run(args):
+    compiler = compiler_info(args.cxx)
+    results = []
+    for depth in args.depths:
+        for members in args.members:
+            baseline = None
+            for api in args.apis:
+                config = {"api": api, "members": members,
+                          "methods": args.methods,
+                          "overloads": args.overloads, "depth": depth}
+                result = dict(config, **measure(args, compiler, config))
+                if api == "none" and result["ok"]:
+                    baseline = result
+                elif baseline is not None and result["ok"]:
+                    result["api_wall_s"] = round(
+                        result["wall_s"] - baseline["wall_s"], 3)
+                    if result["instantiations"] is not None and \
+                            baseline["instantiations"] is not None:
+                        result["api_instantiations"] = (
+                            result["instantiations"] -
+                            baseline["instantiations"])
+                results.append(result)
+                print("%-12s members=%-4d depth=%d %s %7.2fs %8d KiB" % (
+                    api, members, depth, "ok  " if result["ok"] else "FAIL",
+                    result["wall_s"], result["peak_rss_kib"] or 0),
+                    file=sys.stderr)
+    report = {"schema": 1, "compiler": compiler["version"],
+              "std": args.std, "syntax_only": args.syntax_only,
+              "cxxflags": args.cxxflags, "results": results}
+    text = json.dumps(report, indent=2, sort_keys=True) + "\n"
+    if args.output:
+        with open(args.output, "w") as output:
+            output.write(text)
+    else:
+        sys.stdout.write(text)
+    return 0 if all(result["ok"] for result in results) else 1
+
+
+def key(result):
+    return (result["api"], result["members"], result["methods"],
+            result["overloads"], result["depth"])
+
+
+def compare(base_path, new_path):
+    with open(base_path) as base_file, open(new_path) as new_file:
+        base = {key(result): result
+                for result in json.load(base_file)["results"]}
+        new = json.load(new_file)["results"]
+    print("%-12s %7s %5s %9s %9s %7s %9s" % (
+        "api", "members", "depth", "base_s", "new_s", "ratio", "mem_ratio"))
+    for result in new:
+        old = base.get(key(result))
+        if old is None or not old["ok"] or not result["ok"]:
+            continue
+        print("%-12s %7d %5d %9.2f %9.2f %7.2f %9.2f" % (
+            result["api"], result["members"], result["depth"], old["wall_s"],
+            result["wall_s"], result["wall_s"] / max(old["wall_s"], 1e-3),
+            result["peak_rss_kib"] / max(old["peak_rss_kib"], 1)))
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "g++"),
+                        help="compiler (default: $CXX or g++)")
+    parser.add_argument("--std", default="c++17", help="language standard")
+    parser.add_argument("--members", type=int_list, default="10,50,100,250",
+                        help="amounts of reflected variables")
+    parser.add_argument("--methods", type=int, default=10,
+                        help="amount of reflected methods")
+    parser.add_argument("--overloads", type=int, default=2,
+                        help="amount of overloads of each method")
+    parser.add_argument("--depths", type=int_list, default="1,2,3,4,5",
+                        help="amounts of reflected parent levels")
+    parser.add_argument("--apis", type=api_list, default=",".join(APIS),
+                        help="measured APIs, 'none' is used as baseline")
+    parser.add_argument("--repeat", type=int, default=1,
+                        help="compile every configuration N times, "
+                             "report fastest")
+    parser.add_argument("--timeout", type=float, default=600,
+                        help="compilation timeout in seconds")
+    parser.add_argument("--no-instantiations", dest="instantiations",
+                        action="store_false",
+                        help="don't count template instantiations (GCC)")
+    parser.add_argument("--syntax-only", action="store_true",
+                        help="stop after semantic analysis")
+    parser.add_argument("--cxxflags", nargs=argparse.REMAINDER, default=[],
+                        help="additional compiler flags (must be last)")
+    parser.add_argument("-o", "--output", help="report path (default: stdout)")
+    parser.add_argument("--compare", nargs=2, metavar=("BASE", "NEW"),
+                        help="compare two reports instead of running")
+    args = parser.parse_args()
+    if args.compare:
+        return compare(*args.compare)
+    return run(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
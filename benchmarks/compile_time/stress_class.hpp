@@ -0,0 +1,129 @@
+#ifndef COUSCOUS_BENCH_STRESS_CLASS_HPP
+#define COUSCOUS_BENCH_STRESS_CLASS_HPP
+
+#include <boost/preprocessor/arithmetic/dec.hpp>
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/control/if.hpp>
+#include <boost/preprocessor/facilities/empty.hpp>
+#include <boost/preprocessor/facilities/intercept.hpp>
+#include <boost/preprocessor/punctuation/comma_if.hpp>
+#include <boost/preprocessor/repetition/enum_params.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <reflect.hpp>
+
+#ifndef COUSCOUS_BENCH_MEMBERS
+#define COUSCOUS_BENCH_MEMBERS 100 /**< amount of reflected variables */
+#endif
+
+#ifndef COUSCOUS_BENCH_METHODS
+#define COUSCOUS_BENCH_METHODS 10 /**< amount of reflected methods */
+#endif
+
+#ifndef COUSCOUS_BENCH_OVERLOADS
+#define COUSCOUS_BENCH_OVERLOADS 2 /**< amount of overloads of each method */
+#endif
+
+#ifndef COUSCOUS_BENCH_DEPTH
+#define COUSCOUS_BENCH_DEPTH 1 /**< amount of reflected parent levels */
+#endif
+
+#ifndef COUSCOUS_BENCH_LEVEL_MEMBERS
+#define COUSCOUS_BENCH_LEVEL_MEMBERS 5 /**< amount of variables per parent */
+#endif
+
+/**
+ * @brief Calls MACRO with ARGS, ARGS are expanded before call, so commas
+ * produced by BOOST_PP_COMMA_IF separate arguments of MACRO
+ */
+#define COUSCOUS_BENCH_INVOKE(MACRO, ARGS) MACRO ARGS
+
+/**
+ * @brief Declares variable PREFIX<i>
+ */
+#define COUSCOUS_BENCH_DECLARE_VAR(_, i, PREFIX)                               \
+  int BOOST_PP_CAT(PREFIX, i){i};
+
+/**
+ * @brief Reflects variable PREFIX<i>, name is concatenated before call,
+ * because REFLECT_OBJ_VAR stringizes its argument as is
+ */
+#define COUSCOUS_BENCH_REFLECT_VAR(_, i, PREFIX)                               \
+  COUSCOUS_BENCH_INVOKE(REFLECT_OBJ_VAR, (BOOST_PP_CAT(PREFIX, i)))
+
+/**
+ * @brief Declares overload of method NAME with N int arguments
+ */
+#define COUSCOUS_BENCH_DECLARE_OVERLOAD(_, N, NAME)                            \
+  int NAME(BOOST_PP_ENUM_PARAMS(N, int BOOST_PP_INTERCEPT)) { return N; }
+
+/**
+ * @brief Reflects overload of method NAME with N int arguments
+ */
+#define COUSCOUS_BENCH_REFLECT_OVERLOAD(_, N, NAME)                            \
+  COUSCOUS_BENCH_INVOKE(REFLECT_OBJ_MTD,                                      \
+                        (NAME BOOST_PP_COMMA_IF(N) BOOST_PP_ENUM_PARAMS(       \
+                            N, int BOOST_PP_INTERCEPT)))
+
+/**
+ * @brief Declares all overloads of method mtd<i>
+ */
+#define COUSCOUS_BENCH_DECLARE_METHOD(_, i, __)                                \
+  BOOST_PP_REPEAT(COUSCOUS_BENCH_OVERLOADS, COUSCOUS_BENCH_DECLARE_OVERLOAD,   \
+                  BOOST_PP_CAT(mtd, i))
+
+/**
+ * @brief Reflects all overloads of method mtd<i>
+ */
+#define COUSCOUS_BENCH_REFLECT_METHOD(_, i, __)                                \
+  BOOST_PP_REPEAT(COUSCOUS_BENCH_OVERLOADS, COUSCOUS_BENCH_REFLECT_OVERLOAD,   \
+                  BOOST_PP_CAT(mtd, i))
+
+/**
+ * @brief Name of parent class of level L
+ */
+#define COUSCOUS_BENCH_LEVEL_PARENT(L)                                         \
+  BOOST_PP_CAT(StressLevel, BOOST_PP_DEC(L))
+
+/**
+ * @brief Declares and reflects parent level L with variables level<L>_var<i>,
+ * level L > 0 inherits level L - 1
+ */
+#define COUSCOUS_BENCH_DECLARE_LEVEL(_, L, __)                                 \
+  struct BOOST_PP_CAT(StressLevel, L)                                          \
+      BOOST_PP_IF(L, : public COUSCOUS_BENCH_LEVEL_PARENT(L),                  \
+                  BOOST_PP_EMPTY()) {                                          \
+    BOOST_PP_REPEAT(COUSCOUS_BENCH_LEVEL_MEMBERS, COUSCOUS_BENCH_DECLARE_VAR,  \
+                    BOOST_PP_CAT(BOOST_PP_CAT(level, L), _var))                \
+    OUT_METAINFO(BOOST_PP_CAT(StressLevel, L))                                 \
+  };                                                                           \
+  COUSCOUS_BENCH_INVOKE(                                                       \
+      METAINFO, (BOOST_PP_CAT(StressLevel, L) BOOST_PP_COMMA_IF(L)             \
+                     BOOST_PP_IF(L, COUSCOUS_BENCH_LEVEL_PARENT(L),            \
+                                 BOOST_PP_EMPTY())))                           \
+  BOOST_PP_REPEAT(COUSCOUS_BENCH_LEVEL_MEMBERS, COUSCOUS_BENCH_REFLECT_VAR,    \
+                  BOOST_PP_CAT(BOOST_PP_CAT(level, L), _var))                  \
+  END_METAINFO
+
+BOOST_PP_REPEAT(COUSCOUS_BENCH_DEPTH, COUSCOUS_BENCH_DECLARE_LEVEL, _)
+
+/**
+ * @brief Struct with COUSCOUS_BENCH_MEMBERS reflected variables var<i>,
+ * COUSCOUS_BENCH_METHODS reflected methods mtd<i> with COUSCOUS_BENCH_OVERLOADS
+ * overloads each and COUSCOUS_BENCH_DEPTH reflected parent levels
+ */
+struct StressClass final
+    BOOST_PP_IF(COUSCOUS_BENCH_DEPTH,
+                : public COUSCOUS_BENCH_LEVEL_PARENT(COUSCOUS_BENCH_DEPTH),
+                BOOST_PP_EMPTY()) {
+  BOOST_PP_REPEAT(COUSCOUS_BENCH_MEMBERS, COUSCOUS_BENCH_DECLARE_VAR, var)
+  BOOST_PP_REPEAT(COUSCOUS_BENCH_METHODS, COUSCOUS_BENCH_DECLARE_METHOD, _)
+  COUSCOUS_BENCH_INVOKE(
+      IN_METAINFO,
+      (StressClass BOOST_PP_COMMA_IF(COUSCOUS_BENCH_DEPTH) BOOST_PP_IF(
+          COUSCOUS_BENCH_DEPTH,
+          COUSCOUS_BENCH_LEVEL_PARENT(COUSCOUS_BENCH_DEPTH), BOOST_PP_EMPTY())))
+  BOOST_PP_REPEAT(COUSCOUS_BENCH_MEMBERS, COUSCOUS_BENCH_REFLECT_VAR, var)
+  BOOST_PP_REPEAT(COUSCOUS_BENCH_METHODS, COUSCOUS_BENCH_REFLECT_METHOD, _)
+};
+
+#endif // COUSCOUS_BENCH_STRESS_CLASS_HPP
@@ -0,0 +1,100 @@
+#include <chrono>
+#include <cstdio>
+#include <reflect.hpp>
+#include <vector>
+
+#ifndef COUSCOUS_BENCH_OBJECTS
+#define COUSCOUS_BENCH_OBJECTS (1 << 22) /**< amount of stored objects */
+#endif
+
+#ifndef COUSCOUS_BENCH_REPEATS
+#define COUSCOUS_BENCH_REPEATS 8 /**< amount of aggregations */
+#endif
+
+/**
+ * @brief Trade with four aggregated variables
+ */
+struct Trade {
+  long long id{0};
+  double price{0};
+  double volume{0};
+  int quantity{0};
+  bool buy{false};
+  OUT_METAINFO(Trade)
+};
+
+METAINFO(Trade)
+REFLECT_OBJ_VAR(id)
+REFLECT_OBJ_VAR(price)
+REFLECT_OBJ_VAR(volume)
+REFLECT_OBJ_VAR(quantity)
+REFLECT_OBJ_VAR(buy)
+END_METAINFO
+
+/**
+ * @brief Prints time per object and value (to keep computation alive)
+ */
+void report(const char *name, ::std::chrono::duration<double> time,
+            double value) {
+  ::std::printf("%-36s %8.3f ns/object (%g)\n", name,
+                time.count() * 1e9 /
+                    (double(COUSCOUS_BENCH_OBJECTS) * COUSCOUS_BENCH_REPEATS),
+                value);
+}
+
+/**
+ * @brief Runs aggregation COUSCOUS_BENCH_REPEATS times
+ */
+template <class Aggregate>
+void run(const char *name, Aggregate &&aggregate) {
+  double value = 0;
+  auto start = ::std::chrono::steady_clock::now();
+  for (int repeat = 0; repeat < COUSCOUS_BENCH_REPEATS; ++repeat) {
+    const auto result = aggregate();
+    value += result[HANA_STR("price")].mean() + result[HANA_STR("id")].min +
+             result[HANA_STR("volume")].max + result[HANA_STR("quantity")].sum;
+  }
+  report(name, ::std::chrono::steady_clock::now() - start, value);
+}
+
+int main() {
+  ::std::vector<Trade> trades(COUSCOUS_BENCH_OBJECTS);
+  reflect::containers::soa_vector<Trade> soa;
+  soa.reserve(COUSCOUS_BENCH_OBJECTS);
+  for (int i = 0; i < COUSCOUS_BENCH_OBJECTS; ++i) {
+    trades[i].id = i;
+    trades[i].price = 1.0 + i % 100;
+    trades[i].volume = 0.25 * (i % 13);
+    trades[i].quantity = i % 7;
+    soa.push_back(trades[i]);
+  }
+
+  double value = 0;
+  auto start = ::std::chrono::steady_clock::now();
+  for (int repeat = 0; repeat < COUSCOUS_BENCH_REPEATS; ++repeat) {
+    reflect::containers::field_stats<long long> id;
+    reflect::containers::field_stats<double> price;
+    reflect::containers::field_stats<double> volume;
+    reflect::containers::field_stats<int> quantity;
+    for (const auto &trade : trades) {
+      id.add(trade.id);
+      price.add(trade.price);
+      volume.add(trade.volume);
+      quantity.add(trade.quantity);
+    }
+    value += price.mean() + id.min + volume.max + quantity.sum;
+  }
+  report("hand-written loop", ::std::chrono::steady_clock::now() - start,
+         value);
+
+  run("aggregate(std::vector)", [&trades] {
+    return reflect::containers::aggregate<Trade>(trades);
+  });
+  run("aggregate(soa_vector)",
+      [&soa] { return reflect::containers::aggregate(soa); });
+  run("aggregate(std::vector, all threads)", [&trades] {
+    return reflect::containers::aggregate<Trade>(trades, 0);
+  });
+  run("aggregate(soa_vector, all threads)",
+      [&soa] { return reflect::containers::aggregate(soa, 0); });
+}
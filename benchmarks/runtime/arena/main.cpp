@@ -0,0 +1,150 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <reflect.hpp>
+#include <string>
+#include <vector>
+
+#ifndef COUSCOUS_BENCH_MESSAGES
+#define COUSCOUS_BENCH_MESSAGES (1 << 16) /**< amount of read messages */
+#endif
+
+static ::std::size_t allocations = 0; /**< amount of calls of operator new */
+
+/**
+ * @brief Counts allocations
+ */
+void *operator new(::std::size_t size) {
+  ++allocations;
+  if (void *ptr = ::std::malloc(size ? size : 1))
+    return ptr;
+  throw ::std::bad_alloc();
+}
+
+/**
+ * @brief Counts aligned allocations
+ */
+void *operator new(::std::size_t size, ::std::align_val_t alignment) {
+  ++allocations;
+  ::std::size_t align = static_cast<::std::size_t>(alignment);
+  if (void *ptr =
+          ::std::aligned_alloc(align, (size + align - 1) / align * align))
+    return ptr;
+  throw ::std::bad_alloc();
+}
+
+/**
+ * @brief Frees memory allocated by counting operator new
+ */
+void operator delete(void *ptr) noexcept { ::std::free(ptr); }
+
+/**
+ * @brief Frees memory allocated by counting aligned operator new
+ */
+void operator delete(void *ptr, ::std::align_val_t) noexcept {
+  ::std::free(ptr);
+}
+
+/**
+ * @brief Frees memory allocated by counting operator new
+ */
+void operator delete(void *ptr, ::std::size_t) noexcept { ::std::free(ptr); }
+
+/**
+ * @brief Declares message types with containers of given namespace
+ */
+#define COUSCOUS_BENCH_MESSAGE(ITEM, MESSAGE, NS)                              \
+  struct ITEM {                                                                \
+    NS::string name;                                                           \
+    NS::vector<int> values;                                                    \
+    IN_METAINFO(ITEM)                                                          \
+    REFLECT_OBJ_VAR(name)                                                      \
+    REFLECT_OBJ_VAR(values)                                                    \
+  };                                                                           \
+  struct MESSAGE {                                                             \
+    long long id{1};                                                           \
+    NS::string name;                                                           \
+    NS::vector<NS::string> tags;                                               \
+    NS::vector<ITEM> items;                                                    \
+    IN_METAINFO(MESSAGE)                                                       \
+    REFLECT_OBJ_VAR(id)                                                        \
+    REFLECT_OBJ_VAR(name)                                                      \
+    REFLECT_OBJ_VAR(tags)                                                      \
+    REFLECT_OBJ_VAR(items)                                                     \
+  };
+
+COUSCOUS_BENCH_MESSAGE(Item, Message, ::std)
+COUSCOUS_BENCH_MESSAGE(PmrItem, PmrMessage, ::std::pmr)
+
+/**
+ * @brief Message with 8 tags and 16 items
+ */
+Message sample() {
+  Message message;
+  message.name = "message name longer than small string buffer";
+  message.tags.assign(8, "tag longer than small string buffer");
+  message.items.resize(16);
+  for (auto &item : message.items) {
+    item.name = "item name longer than small string buffer";
+    item.values.assign(8, 1);
+  }
+  return message;
+}
+
+/**
+ * @brief Prints latency and allocations per message
+ */
+void report(const char *name, ::std::size_t count,
+            ::std::chrono::duration<double, ::std::nano> time) {
+  ::std::printf("%-28s %8.1f ns/message %8.2f allocations/message\n", name,
+                time.count() / COUSCOUS_BENCH_MESSAGES,
+                static_cast<double>(count) / COUSCOUS_BENCH_MESSAGES);
+}
+
+/**
+ * @brief Measures reading of new message from input by read
+ */
+template <class T, class Read>
+void measure(const char *name, const ::std::string &input, Read &&read) {
+  bool ok = true;
+  ::std::size_t count = allocations;
+  auto start = ::std::chrono::steady_clock::now();
+  for (int i = 0; i < COUSCOUS_BENCH_MESSAGES; ++i)
+    ok = read(input) && ok;
+  ::std::chrono::duration<double, ::std::nano> time =
+      ::std::chrono::steady_clock::now() - start;
+  report(name, allocations - count, time);
+  if (!ok)
+    ::std::printf("reading failed\n");
+}
+
+int main() {
+  const ::std::string bytes = reflect::binary::serialize(sample());
+  const ::std::string json = reflect::json::write(sample());
+  alignas(::std::max_align_t) static char buffer[1 << 16];
+
+  measure<Message>("binary default allocator", bytes,
+                   [](const ::std::string &input) {
+                     Message message;
+                     return reflect::binary::deserialize(input, message);
+                   });
+  measure<PmrMessage>(
+      "binary arena", bytes, [](const ::std::string &input) {
+        ::std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer));
+        PmrMessage message;
+        return reflect::binary::deserialize(input, message, &arena);
+      });
+  measure<Message>("json default allocator", json,
+                   [](const ::std::string &input) {
+                     Message message;
+                     return reflect::json::read(input, message);
+                   });
+  measure<PmrMessage>(
+      "json arena", json, [](const ::std::string &input) {
+        ::std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer));
+        PmrMessage message;
+        return reflect::json::read(input, message, &arena);
+      });
+}
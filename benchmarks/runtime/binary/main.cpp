@@ -0,0 +1,179 @@
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <reflect.hpp>
+#include <string>
+#include <vector>
+
+#ifndef COUSCOUS_BENCH_OBJECTS
+#define COUSCOUS_BENCH_OBJECTS 1 << 16 /**< amount of serialized objects */
+#endif
+
+#ifndef COUSCOUS_BENCH_REPEATS
+#define COUSCOUS_BENCH_REPEATS 32 /**< amount of passes over objects */
+#endif
+
+/**
+ * @brief Trivially copyable variables without padding (one memcpy)
+ */
+struct Flat {
+  long long first{1};
+  long long second{2};
+  double third{3};
+  double fourth{4};
+  int fifth{5};
+  int sixth{6};
+  float seventh{7};
+  unsigned eighth{8};
+  IN_METAINFO(Flat)
+  REFLECT_OBJ_VAR(first)
+  REFLECT_OBJ_VAR(second)
+  REFLECT_OBJ_VAR(third)
+  REFLECT_OBJ_VAR(fourth)
+  REFLECT_OBJ_VAR(fifth)
+  REFLECT_OBJ_VAR(sixth)
+  REFLECT_OBJ_VAR(seventh)
+  REFLECT_OBJ_VAR(eighth)
+};
+
+/**
+ * @brief Variables with padding, string and vector
+ */
+struct Mixed {
+  char tag{'m'};
+  double value{0.5};
+  int count{3};
+  std::string name{"benchmark object"};
+  std::vector<float> samples = std::vector<float>(16, 1.f);
+  IN_METAINFO(Mixed)
+  REFLECT_OBJ_VAR(tag)
+  REFLECT_OBJ_VAR(value)
+  REFLECT_OBJ_VAR(count)
+  REFLECT_OBJ_VAR(name)
+  REFLECT_OBJ_VAR(samples)
+};
+
+/**
+ * @brief Appends trivially copyable value
+ */
+template <class T> void append(::std::string &buffer, const T &value) {
+  buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+/**
+ * @brief Reads trivially copyable value
+ */
+template <class T> void take(const char *&data, T &value) {
+  ::std::memcpy(&value, data, sizeof(T));
+  data += sizeof(T);
+}
+
+/**
+ * @brief Hand-written serialization
+ */
+void handwritten_serialize(const Flat &obj, ::std::string &buffer) {
+  buffer.append(reinterpret_cast<const char *>(&obj), sizeof(Flat));
+}
+
+/**
+ * @brief Hand-written deserialization (without bounds checks)
+ */
+void handwritten_deserialize(const char *&data, Flat &obj) {
+  take(data, obj);
+}
+
+/**
+ * @brief Hand-written serialization
+ */
+void handwritten_serialize(const Mixed &obj, ::std::string &buffer) {
+  append(buffer, obj.tag);
+  append(buffer, obj.value);
+  append(buffer, obj.count);
+  append(buffer, ::std::uint64_t{obj.name.size()});
+  buffer.append(obj.name);
+  append(buffer, ::std::uint64_t{obj.samples.size()});
+  buffer.append(reinterpret_cast<const char *>(obj.samples.data()),
+                obj.samples.size() * sizeof(float));
+}
+
+/**
+ * @brief Hand-written deserialization (without bounds checks)
+ */
+void handwritten_deserialize(const char *&data, Mixed &obj) {
+  ::std::uint64_t size;
+  take(data, obj.tag);
+  take(data, obj.value);
+  take(data, obj.count);
+  take(data, size);
+  obj.name.assign(data, size);
+  data += size;
+  take(data, size);
+  obj.samples.resize(size);
+  ::std::memcpy(obj.samples.data(), data, size * sizeof(float));
+  data += size * sizeof(float);
+}
+
+/**
+ * @brief Prints throughput in GB/s
+ */
+void report(const char *name, const char *type, ::std::size_t bytes,
+            ::std::chrono::duration<double> time) {
+  ::std::printf("%-24s %-6s %8.2f GB/s\n", name, type,
+                bytes / time.count() / 1e9);
+}
+
+/**
+ * @brief Measures serialization and deserialization throughput of objects
+ */
+template <class T> void measure(const char *type) {
+  ::std::vector<T> objects(COUSCOUS_BENCH_OBJECTS);
+  ::std::string buffer;
+  auto start = ::std::chrono::steady_clock::now();
+  for (int repeat = 0; repeat < COUSCOUS_BENCH_REPEATS; ++repeat) {
+    buffer.clear();
+    for (const auto &obj : objects)
+      handwritten_serialize(obj, buffer);
+  }
+  report("handwritten serialize", type,
+         buffer.size() * COUSCOUS_BENCH_REPEATS,
+         ::std::chrono::steady_clock::now() - start);
+
+  ::std::string reflected;
+  start = ::std::chrono::steady_clock::now();
+  for (int repeat = 0; repeat < COUSCOUS_BENCH_REPEATS; ++repeat) {
+    reflected.clear();
+    for (const auto &obj : objects)
+      reflect::binary::serialize(obj, reflected);
+  }
+  report("binary::serialize", type, reflected.size() * COUSCOUS_BENCH_REPEATS,
+         ::std::chrono::steady_clock::now() - start);
+  if (reflected != buffer)
+    ::std::printf("output differs\n");
+
+  start = ::std::chrono::steady_clock::now();
+  for (int repeat = 0; repeat < COUSCOUS_BENCH_REPEATS; ++repeat) {
+    const char *data = buffer.data();
+    for (auto &obj : objects)
+      handwritten_deserialize(data, obj);
+  }
+  report("handwritten deserialize", type,
+         buffer.size() * COUSCOUS_BENCH_REPEATS,
+         ::std::chrono::steady_clock::now() - start);
+
+  bool ok = true;
+  start = ::std::chrono::steady_clock::now();
+  for (int repeat = 0; repeat < COUSCOUS_BENCH_REPEATS; ++repeat) {
+    reflect::binary::Reader reader(reflected);
+    for (auto &obj : objects)
+      ok = reflect::binary::deserialize(reader, obj) && ok;
+  }
+  report("binary::deserialize", type, reflected.size() * COUSCOUS_BENCH_REPEATS,
+         ::std::chrono::steady_clock::now() - start);
+  if (!ok)
+    ::std::printf("deserialization failed\n");
+}
+
+int main() {
+  measure<Flat>("Flat");
+  measure<Mixed>("Mixed");
+}
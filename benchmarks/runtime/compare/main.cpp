@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <random>
+#include <reflect.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifndef COUSCOUS_BENCH_KEYS
+#define COUSCOUS_BENCH_KEYS (1 << 16) /**< amount of keys */
+#endif
+
+#ifndef COUSCOUS_BENCH_REPEATS
+#define COUSCOUS_BENCH_REPEATS 64 /**< amount of lookups of every key */
+#endif
+
+/**
+ * @brief Key without padding, compared and hashed as bytes
+ */
+struct PlainKey {
+  int venue{0};
+  int instrument{0};
+  long long account{0};
+  IN_METAINFO(PlainKey)
+  REFLECT_OBJ_VAR(venue)
+  REFLECT_OBJ_VAR(instrument)
+  REFLECT_OBJ_VAR(account)
+};
+
+/**
+ * @brief Key with std::string, compared and hashed by variables
+ */
+struct NamedKey {
+  int venue{0};
+  std::string symbol;
+  IN_METAINFO(NamedKey)
+  REFLECT_OBJ_VAR(venue)
+  REFLECT_OBJ_VAR(symbol)
+};
+
+/**
+ * @brief Hand-written hash and equality of keys
+ */
+struct HandWritten {
+  ::std::size_t operator()(const PlainKey &key) const {
+    ::std::size_t hash = ::std::hash<int>{}(key.venue);
+    hash = hash * 31 + ::std::hash<int>{}(key.instrument);
+    return hash * 31 + ::std::hash<long long>{}(key.account);
+  }
+  ::std::size_t operator()(const NamedKey &key) const {
+    return ::std::hash<int>{}(key.venue) * 31 +
+           ::std::hash<::std::string>{}(key.symbol);
+  }
+  bool operator()(const PlainKey &left, const PlainKey &right) const {
+    return left.venue == right.venue && left.instrument == right.instrument &&
+           left.account == right.account;
+  }
+  bool operator()(const NamedKey &left, const NamedKey &right) const {
+    return left.venue == right.venue && left.symbol == right.symbol;
+  }
+};
+
+/**
+ * @brief Hand-written ordering of keys
+ */
+struct HandWrittenLess {
+  bool operator()(const NamedKey &left, const NamedKey &right) const {
+    if (left.venue != right.venue)
+      return left.venue < right.venue;
+    return left.symbol < right.symbol;
+  }
+};
+
+/**
+ * @brief Prints time per lookup and value (to keep computation alive)
+ */
+void report(const char *name, ::std::chrono::duration<double> time,
+            long long value) {
+  ::std::printf("%-36s %8.3f ns/lookup (%lld)\n", name,
+                time.count() * 1e9 /
+                    (double(COUSCOUS_BENCH_KEYS) * COUSCOUS_BENCH_REPEATS),
+                value);
+}
+
+/**
+ * @brief Fills map with keys and looks up every key COUSCOUS_BENCH_REPEATS
+ * times
+ */
+template <class Map, class Key>
+void run(const char *name, ::std::vector<Key> keys) {
+  Map map;
+  for (::std::size_t i = 0; i < keys.size(); ++i)
+    map[keys[i]] = static_cast<long long>(i);
+  // keys are looked up in random order, so buckets aren't visited one after
+  // another
+  ::std::shuffle(keys.begin(), keys.end(), ::std::mt19937(42));
+  long long value = 0;
+  auto start = ::std::chrono::steady_clock::now();
+  for (int repeat = 0; repeat < COUSCOUS_BENCH_REPEATS; ++repeat)
+    for (const auto &key : keys)
+      value += map.find(key)->second;
+  report(name, ::std::chrono::steady_clock::now() - start, value);
+}
+
+int main() {
+  ::std::vector<PlainKey> plain_keys;
+  ::std::vector<NamedKey> named_keys;
+  for (int i = 0; i < COUSCOUS_BENCH_KEYS; ++i) {
+    plain_keys.push_back({i % 16, i / 16, i * 7ll});
+    named_keys.push_back({i % 16, "SYMBOL" + ::std::to_string(i / 16)});
+  }
+
+  run<::std::unordered_map<PlainKey, long long, HandWritten, HandWritten>>(
+      "unordered_map<PlainKey> hand-written", plain_keys);
+  run<::std::unordered_map<PlainKey, long long, reflect::utils::hash<PlainKey>,
+                           reflect::utils::equal<PlainKey>>>(
+      "unordered_map<PlainKey> reflect", plain_keys);
+  run<::std::unordered_map<NamedKey, long long, HandWritten, HandWritten>>(
+      "unordered_map<NamedKey> hand-written", named_keys);
+  run<::std::unordered_map<NamedKey, long long, reflect::utils::hash<NamedKey>,
+                           reflect::utils::equal<NamedKey>>>(
+      "unordered_map<NamedKey> reflect", named_keys);
+  run<::std::map<NamedKey, long long, HandWrittenLess>>(
+      "map<NamedKey> hand-written", named_keys);
+  run<::std::map<NamedKey, long long, reflect::utils::less<NamedKey>>>(
+      "map<NamedKey> reflect", named_keys);
+}
@@ -0,0 +1,88 @@
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <chrono>
+#include <cstdio>
+#include <reflect.hpp>
+#include <string>
+
+#ifndef COUSCOUS_BENCH_TICKS
+#define COUSCOUS_BENCH_TICKS (1 << 20) /**< amount of replicated updates */
+#endif
+
+/**
+ * @brief Declares variable var<i>
+ */
+#define COUSCOUS_BENCH_DECLARE_VAR(_, i, __) long long BOOST_PP_CAT(var, i){i};
+
+/**
+ * @brief Reflects variable NAME, name is concatenated before call, because
+ * REFLECT_OBJ_VAR stringizes its argument as is
+ */
+#define COUSCOUS_BENCH_REFLECT_NAME(NAME) REFLECT_OBJ_VAR(NAME)
+
+/**
+ * @brief Reflects variable var<i>
+ */
+#define COUSCOUS_BENCH_REFLECT_VAR(_, i, __)                                   \
+  COUSCOUS_BENCH_REFLECT_NAME(BOOST_PP_CAT(var, i))
+
+/**
+ * @brief Replicated state with 100 variables
+ */
+struct State {
+  BOOST_PP_REPEAT(100, COUSCOUS_BENCH_DECLARE_VAR, _)
+  IN_METAINFO(State)
+  BOOST_PP_REPEAT(100, COUSCOUS_BENCH_REFLECT_VAR, _)
+};
+
+/**
+ * @brief Changes 3 variables of state
+ */
+void tick(State &state, int i) {
+  for (int j = 0; j < 3; ++j)
+    reflect::utils::visit_member<State, reflect::ObjVars>(
+        state, (i * 37 + j * 13) % 100, [](auto index, State &obj) {
+          ++reflect::utils::invoke<State, reflect::ObjVars>(index, obj);
+        });
+}
+
+/**
+ * @brief Prints time and bytes per tick
+ */
+void report(const char *name, ::std::chrono::duration<double> time,
+            ::std::size_t bytes, bool ok) {
+  ::std::printf("%-24s %8.2f ns/tick %8.1f bytes/tick%s\n", name,
+                time.count() * 1e9 / COUSCOUS_BENCH_TICKS,
+                double(bytes) / COUSCOUS_BENCH_TICKS, ok ? "" : " (failed)");
+}
+
+int main() {
+  State sender, receiver;
+  ::std::string buffer;
+  ::std::size_t bytes = 0;
+  bool ok = true;
+  auto start = ::std::chrono::steady_clock::now();
+  for (int i = 0; i < COUSCOUS_BENCH_TICKS; ++i) {
+    tick(sender, i);
+    buffer.clear();
+    reflect::binary::serialize(sender, buffer);
+    bytes += buffer.size();
+    ok = reflect::binary::deserialize(buffer, receiver) && ok;
+  }
+  report("full serialization", ::std::chrono::steady_clock::now() - start,
+         bytes, ok && reflect::utils::equal<State>{}(sender, receiver));
+
+  State baseline = sender;
+  bytes = 0;
+  start = ::std::chrono::steady_clock::now();
+  for (int i = 0; i < COUSCOUS_BENCH_TICKS; ++i) {
+    tick(sender, i);
+    buffer.clear();
+    reflect::binary::serialize_delta(baseline, sender, buffer);
+    baseline = sender;
+    bytes += buffer.size();
+    ok = reflect::binary::deserialize_delta(buffer, receiver) && ok;
+  }
+  report("delta serialization", ::std::chrono::steady_clock::now() - start,
+         bytes, ok && reflect::utils::equal<State>{}(sender, receiver));
+}
@@ -0,0 +1,83 @@
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <chrono>
+#include <cstdio>
+#include <reflect.hpp>
+#include <vector>
+
+#ifndef COUSCOUS_BENCH_DIFFS
+#define COUSCOUS_BENCH_DIFFS (1 << 20) /**< amount of compared pairs */
+#endif
+
+/**
+ * @brief Declares variable var<i>
+ */
+#define COUSCOUS_BENCH_DECLARE_VAR(_, i, TYPE) TYPE BOOST_PP_CAT(var, i){i};
+
+/**
+ * @brief Reflects variable NAME, name is concatenated before call, because
+ * REFLECT_OBJ_VAR stringizes its argument as is
+ */
+#define COUSCOUS_BENCH_REFLECT_NAME(NAME) REFLECT_OBJ_VAR(NAME)
+
+/**
+ * @brief Reflects variable var<i>
+ */
+#define COUSCOUS_BENCH_REFLECT_VAR(_, i, __)                                   \
+  COUSCOUS_BENCH_REFLECT_NAME(BOOST_PP_CAT(var, i))
+
+/**
+ * @brief Declares struct NAME with 100 reflected variables of TYPE
+ */
+#define COUSCOUS_BENCH_STRUCT(NAME, TYPE)                                      \
+  struct NAME {                                                                \
+    BOOST_PP_REPEAT(100, COUSCOUS_BENCH_DECLARE_VAR, TYPE)                     \
+    IN_METAINFO(NAME)                                                          \
+    BOOST_PP_REPEAT(100, COUSCOUS_BENCH_REFLECT_VAR, _)                        \
+  };
+
+COUSCOUS_BENCH_STRUCT(Ints100, int)
+COUSCOUS_BENCH_STRUCT(Doubles100, double)
+
+/**
+ * @brief Measures diff of objects where `changed` variables differ, and diff
+ * with apply_patch
+ */
+template <class T> void measure(const char *name, int changed) {
+  ::std::vector<T> snapshots(16);
+  for (::std::size_t i = 0; i < snapshots.size(); ++i)
+    for (int j = 0; j < changed; ++j)
+      reflect::utils::visit_member<T, reflect::ObjVars>(
+          snapshots[i], (i * 37 + j * 41) % 100, [](auto index, auto &obj) {
+            ++reflect::utils::invoke<T, reflect::ObjVars>(index, obj);
+          });
+  ::std::size_t bits = 0;
+  auto start = ::std::chrono::steady_clock::now();
+  for (int i = 0; i < COUSCOUS_BENCH_DIFFS; ++i)
+    bits += reflect::utils::diff(snapshots[i % 16], snapshots[(i + 1) % 16])
+                .count();
+  ::std::chrono::duration<double, ::std::nano> diff_time =
+      ::std::chrono::steady_clock::now() - start;
+  T obj;
+  start = ::std::chrono::steady_clock::now();
+  for (int i = 0; i < COUSCOUS_BENCH_DIFFS; ++i) {
+    const T &source = snapshots[i % 16];
+    reflect::utils::apply_patch(obj, reflect::utils::diff(obj, source),
+                                source);
+  }
+  ::std::chrono::duration<double, ::std::nano> patch_time =
+      ::std::chrono::steady_clock::now() - start;
+  ::std::printf("%-10s changed=%-3d diff %7.2f ns (%6.2f GB/s) "
+                "diff+apply_patch %7.2f ns (%zu)\n",
+                name, changed, diff_time.count() / COUSCOUS_BENCH_DIFFS,
+                2.0 * sizeof(T) * COUSCOUS_BENCH_DIFFS / diff_time.count(),
+                patch_time.count() / COUSCOUS_BENCH_DIFFS,
+                bits + reflect::utils::diff(obj, T{}).count());
+}
+
+int main() {
+  for (int changed : {0, 3, 50}) {
+    measure<Ints100>("Ints100", changed);
+    measure<Doubles100>("Doubles100", changed);
+  }
+}
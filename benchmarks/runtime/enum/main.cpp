@@ -0,0 +1,176 @@
+#include <chrono>
+#include <cstdio>
+#include <reflect.hpp>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#ifndef COUSCOUS_BENCH_LOOKUPS
+#define COUSCOUS_BENCH_LOOKUPS (1 << 22) /**< amount of lookups */
+#endif
+
+namespace bench {
+
+enum class Method {
+  get,
+  head,
+  post,
+  put,
+  patch,
+  remove,
+  options,
+  trace,
+  connect,
+  propfind,
+  proppatch,
+  mkcol,
+  copy,
+  move,
+  lock,
+  unlock
+};
+
+enum class Status : int {
+  ok = 200,
+  created = 201,
+  accepted = 202,
+  no_content = 204,
+  moved = 301,
+  found = 302,
+  not_modified = 304,
+  bad_request = 400,
+  unauthorized = 401,
+  forbidden = 403,
+  not_found = 404,
+  conflict = 409,
+  internal_error = 500,
+  not_implemented = 501,
+  bad_gateway = 502,
+  unavailable = 503
+};
+} // namespace bench
+
+REFLECT_ENUM(bench::Method, get, head, post, put, patch, remove, options,
+             trace, connect, propfind, proppatch, mkcol, copy, move, lock,
+             unlock)
+REFLECT_ENUM(bench::Status, ok, created, accepted, no_content, moved, found,
+             not_modified, bad_request, unauthorized, forbidden, not_found,
+             conflict, internal_error, not_implemented, bad_gateway,
+             unavailable)
+
+/**
+ * @brief Hand-written name of status
+ */
+std::string_view status_name(bench::Status status) {
+  switch (status) {
+  case bench::Status::ok:
+    return "ok";
+  case bench::Status::created:
+    return "created";
+  case bench::Status::accepted:
+    return "accepted";
+  case bench::Status::no_content:
+    return "no_content";
+  case bench::Status::moved:
+    return "moved";
+  case bench::Status::found:
+    return "found";
+  case bench::Status::not_modified:
+    return "not_modified";
+  case bench::Status::bad_request:
+    return "bad_request";
+  case bench::Status::unauthorized:
+    return "unauthorized";
+  case bench::Status::forbidden:
+    return "forbidden";
+  case bench::Status::not_found:
+    return "not_found";
+  case bench::Status::conflict:
+    return "conflict";
+  case bench::Status::internal_error:
+    return "internal_error";
+  case bench::Status::not_implemented:
+    return "not_implemented";
+  case bench::Status::bad_gateway:
+    return "bad_gateway";
+  case bench::Status::unavailable:
+    return "unavailable";
+  }
+  return {};
+}
+
+/**
+ * @brief Measures ns per call of lookup over inputs
+ */
+template <class Input, class Lookup>
+double measure(const std::vector<Input> &inputs, Lookup &&lookup,
+               std::size_t &check) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < COUSCOUS_BENCH_LOOKUPS; ++i)
+    check += lookup(inputs[i % inputs.size()]);
+  std::chrono::duration<double, std::nano> time =
+      std::chrono::steady_clock::now() - start;
+  return time.count() / COUSCOUS_BENCH_LOOKUPS;
+}
+
+int main() {
+  constexpr auto &statuses = reflect::utils::enum_values<bench::Status>();
+  constexpr auto &methods = reflect::utils::enum_values<bench::Method>();
+  std::vector<bench::Method> method_values;
+  std::vector<bench::Status> status_values;
+  std::vector<std::string_view> names;
+  for (std::size_t i = 0; i < 1024; ++i) {
+    method_values.push_back(methods[(i * 7) % methods.size()]);
+    status_values.push_back(statuses[(i * 7) % statuses.size()]);
+    names.push_back(reflect::utils::enum_to_string(status_values.back()));
+  }
+  std::unordered_map<std::string_view, bench::Status> map;
+  for (auto status : statuses)
+    map.emplace(reflect::utils::enum_to_string(status), status);
+
+  std::size_t check = 0;
+  const double dense = measure(
+      method_values,
+      [](bench::Method method) {
+        return reflect::utils::enum_to_string(method).size();
+      },
+      check);
+  const double sorted = measure(
+      status_values,
+      [](bench::Status status) {
+        return reflect::utils::enum_to_string(status).size();
+      },
+      check);
+  const double hand_written = measure(
+      status_values,
+      [](bench::Status status) { return status_name(status).size(); }, check);
+  const double perfect = measure(
+      names,
+      [](std::string_view name) {
+        return static_cast<std::size_t>(
+            *reflect::utils::enum_from_string<bench::Status>(name));
+      },
+      check);
+  const double linear = measure(
+      names,
+      [&statuses](std::string_view name) {
+        for (auto status : statuses)
+          if (reflect::utils::enum_to_string(status) == name)
+            return static_cast<std::size_t>(status);
+        return std::size_t{0};
+      },
+      check);
+  const double unordered = measure(
+      names,
+      [&map](std::string_view name) {
+        return static_cast<std::size_t>(map.find(name)->second);
+      },
+      check);
+  std::printf("enum_to_string (dense table)    %6.2f ns\n", dense);
+  std::printf("enum_to_string (sorted table)   %6.2f ns\n", sorted);
+  std::printf("switch                          %6.2f ns\n", hand_written);
+  std::printf("enum_from_string (perfect hash) %6.2f ns\n", perfect);
+  std::printf("linear search                   %6.2f ns\n", linear);
+  std::printf("std::unordered_map              %6.2f ns\n", unordered);
+  std::printf("%zu\n", check);
+}
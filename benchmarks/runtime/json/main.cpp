@@ -0,0 +1,131 @@
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <limits>
+#include <reflect.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef COUSCOUS_BENCH_OBJECTS
+#define COUSCOUS_BENCH_OBJECTS (1 << 14) /**< amount of written objects */
+#endif
+
+#ifndef COUSCOUS_BENCH_REPEATS
+#define COUSCOUS_BENCH_REPEATS 16 /**< amount of passes over objects */
+#endif
+
+/**
+ * @brief Nested record
+ */
+struct Position {
+  double latitude{55.7558};
+  double longitude{37.6173};
+  IN_METAINFO(Position)
+  REFLECT_OBJ_VAR(latitude)
+  REFLECT_OBJ_VAR(longitude)
+};
+
+/**
+ * @brief Record with numbers, strings, vectors and nested record
+ */
+struct Record {
+  long long id{1234567890};
+  int quantity{42};
+  double price{1999.99};
+  bool active{true};
+  std::string name{"Reflected record with a fairly long name"};
+  std::string comment{"line one\nline \"two\""};
+  std::vector<int> counters = std::vector<int>(8, 123456);
+  Position position;
+  IN_METAINFO(Record)
+  REFLECT_OBJ_VAR(id)
+  REFLECT_OBJ_VAR(quantity)
+  REFLECT_OBJ_VAR(price)
+  REFLECT_OBJ_VAR(active)
+  REFLECT_OBJ_VAR(name)
+  REFLECT_OBJ_VAR(comment)
+  REFLECT_OBJ_VAR(counters)
+  REFLECT_OBJ_VAR(position)
+};
+
+/**
+ * @brief Naive escaped string printer
+ */
+void naive_string(::std::ostream &stream, const ::std::string &str) {
+  stream << '"';
+  for (char c : str)
+    switch (c) {
+    case '"':
+      stream << "\\\"";
+      break;
+    case '\\':
+      stream << "\\\\";
+      break;
+    case '\n':
+      stream << "\\n";
+      break;
+    default:
+      stream << c;
+    }
+  stream << '"';
+}
+
+/**
+ * @brief Naive ostream-based printer
+ */
+void naive_write(::std::ostream &stream, const Record &record) {
+  stream << "{\"id\":" << record.id << ",\"quantity\":" << record.quantity
+         << ",\"price\":" << record.price
+         << ",\"active\":" << (record.active ? "true" : "false")
+         << ",\"name\":";
+  naive_string(stream, record.name);
+  stream << ",\"comment\":";
+  naive_string(stream, record.comment);
+  stream << ",\"counters\":[";
+  for (::std::size_t i = 0; i < record.counters.size(); ++i)
+    stream << (i ? "," : "") << record.counters[i];
+  stream << "],\"position\":{\"latitude\":" << record.position.latitude
+         << ",\"longitude\":" << record.position.longitude << "}}";
+}
+
+/**
+ * @brief Prints throughput
+ */
+void report(const char *name, ::std::size_t bytes,
+            ::std::chrono::duration<double> time) {
+  ::std::printf("%-20s %8.1f MB/s %8.1f ns/record\n", name,
+                bytes / time.count() / 1e6,
+                time.count() * 1e9 / COUSCOUS_BENCH_OBJECTS /
+                    COUSCOUS_BENCH_REPEATS);
+}
+
+int main() {
+  ::std::vector<Record> records(COUSCOUS_BENCH_OBJECTS);
+  ::std::size_t bytes = 0;
+  auto start = ::std::chrono::steady_clock::now();
+  for (int repeat = 0; repeat < COUSCOUS_BENCH_REPEATS; ++repeat) {
+    ::std::ostringstream stream;
+    stream << ::std::setprecision(::std::numeric_limits<double>::max_digits10)
+           << '[';
+    for (const auto &record : records) {
+      naive_write(stream, record);
+      stream << ',';
+    }
+    bytes += stream.str().size();
+  }
+  report("ostream", bytes, ::std::chrono::steady_clock::now() - start);
+
+  ::std::string buffer;
+  bytes = 0;
+  start = ::std::chrono::steady_clock::now();
+  for (int repeat = 0; repeat < COUSCOUS_BENCH_REPEATS; ++repeat) {
+    buffer.assign(1, '[');
+    for (const auto &record : records) {
+      reflect::json::write(record, buffer);
+      buffer.push_back(',');
+    }
+    bytes += buffer.size();
+  }
+  report("json::write", bytes, ::std::chrono::steady_clock::now() - start);
+}
@@ -0,0 +1,67 @@
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <chrono>
+#include <cstdio>
+#include <reflect.hpp>
+#include <string>
+
+#ifndef COUSCOUS_BENCH_KEYS
+#define COUSCOUS_BENCH_KEYS (1 << 22) /**< amount of parsed keys */
+#endif
+
+/**
+ * @brief Declares variable var<i>
+ */
+#define COUSCOUS_BENCH_DECLARE_VAR(_, i, __) long long BOOST_PP_CAT(var, i){i};
+
+/**
+ * @brief Reflects variable NAME, name is concatenated before call, because
+ * REFLECT_OBJ_VAR stringizes its argument as is
+ */
+#define COUSCOUS_BENCH_REFLECT_NAME(NAME) REFLECT_OBJ_VAR(NAME)
+
+/**
+ * @brief Reflects variable var<i>
+ */
+#define COUSCOUS_BENCH_REFLECT_VAR(_, i, __)                                   \
+  COUSCOUS_BENCH_REFLECT_NAME(BOOST_PP_CAT(var, i))
+
+/**
+ * @brief Declares struct NAME with N reflected variables
+ */
+#define COUSCOUS_BENCH_STRUCT(NAME, N)                                         \
+  struct NAME {                                                                \
+    BOOST_PP_REPEAT(N, COUSCOUS_BENCH_DECLARE_VAR, _)                          \
+    IN_METAINFO(NAME)                                                          \
+    BOOST_PP_REPEAT(N, COUSCOUS_BENCH_REFLECT_VAR, _)                          \
+  };
+
+COUSCOUS_BENCH_STRUCT(Members10, 10)
+COUSCOUS_BENCH_STRUCT(Members50, 50)
+COUSCOUS_BENCH_STRUCT(Members200, 200)
+
+/**
+ * @brief Measures time of reading JSON object per key
+ */
+template <class T> void measure() {
+  constexpr ::std::size_t count = reflect::utils::count<T>();
+  ::std::string json = reflect::json::write(T{});
+  T obj;
+  bool ok = true;
+  auto start = ::std::chrono::steady_clock::now();
+  for (::std::size_t i = 0; i < COUSCOUS_BENCH_KEYS / count; ++i)
+    ok = reflect::json::read(json, obj) && ok;
+  ::std::chrono::duration<double, ::std::nano> time =
+      ::std::chrono::steady_clock::now() - start;
+  ::std::printf("json::read members=%-4zu %8.2f ns/key %8.1f MB/s%s\n", count,
+                time.count() / (COUSCOUS_BENCH_KEYS / count * count),
+                json.size() * (COUSCOUS_BENCH_KEYS / count) * 1e3 /
+                    time.count(),
+                ok ? "" : " (failed)");
+}
+
+int main() {
+  measure<Members10>();
+  measure<Members50>();
+  measure<Members200>();
+}
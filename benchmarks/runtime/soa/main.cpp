@@ -0,0 +1,108 @@
+#include <chrono>
+#include <cstdio>
+#include <reflect.hpp>
+#include <vector>
+
+#ifndef COUSCOUS_BENCH_OBJECTS
+#define COUSCOUS_BENCH_OBJECTS (1 << 20) /**< amount of stored objects */
+#endif
+
+#ifndef COUSCOUS_BENCH_REPEATS
+#define COUSCOUS_BENCH_REPEATS 32 /**< amount of scans */
+#endif
+
+/**
+ * @brief Reflected parent (its variables are columns too)
+ */
+struct Instrument {
+  long long id{0};
+  long long venue{0};
+  OUT_METAINFO(Instrument)
+};
+
+METAINFO(Instrument)
+REFLECT_OBJ_VAR(id)
+REFLECT_OBJ_VAR(venue)
+END_METAINFO
+
+/**
+ * @brief Order of 64 bytes, scans read 8 or 12 bytes of them
+ */
+struct Order : Instrument {
+  double price{0};
+  int quantity{0};
+  int side{0};
+  double fee{0};
+  long long timestamp{0};
+  long long account{0};
+  long long flags{0};
+  IN_METAINFO(Order, Instrument)
+  REFLECT_OBJ_VAR(price)
+  REFLECT_OBJ_VAR(quantity)
+  REFLECT_OBJ_VAR(side)
+  REFLECT_OBJ_VAR(fee)
+  REFLECT_OBJ_VAR(timestamp)
+  REFLECT_OBJ_VAR(account)
+  REFLECT_OBJ_VAR(flags)
+};
+
+/**
+ * @brief Prints time per element and value (to keep computation alive)
+ */
+void report(const char *name, ::std::chrono::duration<double> time,
+            double value) {
+  ::std::printf("%-32s %8.3f ns/element (%g)\n", name,
+                time.count() * 1e9 /
+                    (double(COUSCOUS_BENCH_OBJECTS) * COUSCOUS_BENCH_REPEATS),
+                value);
+}
+
+int main() {
+  ::std::vector<Order> orders;
+  reflect::containers::soa_vector<Order> soa;
+  orders.reserve(COUSCOUS_BENCH_OBJECTS);
+  soa.reserve(COUSCOUS_BENCH_OBJECTS);
+  for (int i = 0; i < COUSCOUS_BENCH_OBJECTS; ++i) {
+    Order order;
+    order.id = i;
+    order.price = 1.0 + i % 100;
+    order.quantity = i % 7;
+    orders.push_back(order);
+    soa.push_back(order);
+  }
+
+  double sum = 0;
+  auto start = ::std::chrono::steady_clock::now();
+  for (int repeat = 0; repeat < COUSCOUS_BENCH_REPEATS; ++repeat)
+    for (const auto &order : orders)
+      sum += order.price;
+  report("std::vector sum(price)", ::std::chrono::steady_clock::now() - start,
+         sum);
+
+  sum = 0;
+  start = ::std::chrono::steady_clock::now();
+  for (int repeat = 0; repeat < COUSCOUS_BENCH_REPEATS; ++repeat)
+    for (double price : soa.column(HANA_STR("price")))
+      sum += price;
+  report("soa_vector sum(price)", ::std::chrono::steady_clock::now() - start,
+         sum);
+
+  sum = 0;
+  start = ::std::chrono::steady_clock::now();
+  for (int repeat = 0; repeat < COUSCOUS_BENCH_REPEATS; ++repeat)
+    for (const auto &order : orders)
+      sum += order.price * order.quantity;
+  report("std::vector sum(price*quantity)",
+         ::std::chrono::steady_clock::now() - start, sum);
+
+  sum = 0;
+  start = ::std::chrono::steady_clock::now();
+  for (int repeat = 0; repeat < COUSCOUS_BENCH_REPEATS; ++repeat) {
+    const auto &prices = soa.column(HANA_STR("price"));
+    const auto &quantities = soa.column(HANA_STR("quantity"));
+    for (::std::size_t i = 0; i < prices.size(); ++i)
+      sum += prices[i] * quantities[i];
+  }
+  report("soa_vector sum(price*quantity)",
+         ::std::chrono::steady_clock::now() - start, sum);
+}
@@ -0,0 +1,84 @@
+#include <chrono>
+#include <cstdio>
+#include <reflect.hpp>
+#include <vector>
+
+#ifndef COUSCOUS_BENCH_WRITES
+#define COUSCOUS_BENCH_WRITES (1 << 24) /**< amount of member writes */
+#endif
+
+#ifndef COUSCOUS_BENCH_OBJECTS
+#define COUSCOUS_BENCH_OBJECTS 4096 /**< amount of written objects */
+#endif
+
+struct Account {
+  long long id{0};
+  long long balance{0};
+  int flags{0};
+  int version{0};
+  double rate{0};
+  IN_METAINFO(Account)
+  REFLECT_OBJ_VAR(id)
+  REFLECT_OBJ_VAR(balance)
+  REFLECT_OBJ_VAR(flags)
+  REFLECT_OBJ_VAR(version)
+  REFLECT_OBJ_VAR(rate)
+};
+
+/**
+ * @brief Writes balance, version and rate of objects, write is raw member
+ * store or tracked set
+ * @param objects - written objects
+ * @param write - function (object, value)
+ * @return ns per member write
+ */
+template <class Object, class Write>
+double measure(::std::vector<Object> &objects, Write &&write) {
+  auto start = ::std::chrono::steady_clock::now();
+  for (int i = 0; i < COUSCOUS_BENCH_WRITES / 3; ++i)
+    write(objects[i % COUSCOUS_BENCH_OBJECTS], i);
+  ::std::chrono::duration<double, ::std::nano> time =
+      ::std::chrono::steady_clock::now() - start;
+  return time.count() / (COUSCOUS_BENCH_WRITES / 3 * 3);
+}
+
+int main() {
+  ::std::vector<Account> raw(COUSCOUS_BENCH_OBJECTS);
+  ::std::vector<reflect::tracked<Account>> tracked(COUSCOUS_BENCH_OBJECTS);
+  double raw_time = 0;
+  double tracked_time = 0;
+  double named_time = 0;
+  for (int run = 0; run < 5; ++run) {
+    raw_time += measure(raw, [](Account &obj, int i) {
+      obj.balance += i;
+      obj.version = i;
+      obj.rate = i * 0.5;
+    });
+    tracked_time +=
+        measure(tracked, [](reflect::tracked<Account> &obj, int i) {
+          obj.set<1>(obj.get<1>() + i);
+          obj.set<3>(i);
+          obj.set<4>(i * 0.5);
+        });
+    named_time +=
+        measure(tracked, [](reflect::tracked<Account> &obj, int i) {
+          obj.set(HANA_STR("balance"),
+                  obj[HANA_STR("balance")] + i);
+          obj.set(HANA_STR("version"), i);
+          obj.set(HANA_STR("rate"), i * 0.5);
+        });
+  }
+  long long check = 0;
+  ::std::size_t dirty = 0;
+  for (int i = 0; i < COUSCOUS_BENCH_OBJECTS; ++i) {
+    check += raw[i].balance + raw[i].version + tracked[i]->balance +
+             static_cast<long long>(raw[i].rate + tracked[i]->rate);
+    dirty += tracked[i].dirty().count();
+  }
+  ::std::printf("raw store          %6.2f ns/write\n", raw_time / 5);
+  ::std::printf("tracked set        %6.2f ns/write\n", tracked_time / 5);
+  ::std::printf("tracked set (name) %6.2f ns/write\n", named_time / 5);
+  ::std::printf("tracked size %zu bytes, object size %zu bytes\n",
+                sizeof(reflect::tracked<Account>), sizeof(Account));
+  ::std::printf("%lld %zu\n", check, dirty);
+}
@@ -0,0 +1,108 @@
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <reflect.hpp>
+#include <vector>
+
+#ifndef COUSCOUS_BENCH_LOOKUPS
+#define COUSCOUS_BENCH_LOOKUPS 1 << 22 /**< amount of visited elements */
+#endif
+
+/**
+ * @brief Declares variable var<i>
+ */
+#define COUSCOUS_BENCH_DECLARE_VAR(_, i, __) long long BOOST_PP_CAT(var, i){i};
+
+/**
+ * @brief Reflects variable NAME, name is concatenated before call, because
+ * REFLECT_OBJ_VAR stringizes its argument as is
+ */
+#define COUSCOUS_BENCH_REFLECT_NAME(NAME) REFLECT_OBJ_VAR(NAME)
+
+/**
+ * @brief Reflects variable var<i>
+ */
+#define COUSCOUS_BENCH_REFLECT_VAR(_, i, __)                                   \
+  COUSCOUS_BENCH_REFLECT_NAME(BOOST_PP_CAT(var, i))
+
+/**
+ * @brief Declares struct NAME with N reflected variables
+ */
+#define COUSCOUS_BENCH_STRUCT(NAME, N)                                         \
+  struct NAME {                                                                \
+    BOOST_PP_REPEAT(N, COUSCOUS_BENCH_DECLARE_VAR, _)                          \
+    IN_METAINFO(NAME)                                                          \
+    BOOST_PP_REPEAT(N, COUSCOUS_BENCH_REFLECT_VAR, _)                          \
+  };
+
+COUSCOUS_BENCH_STRUCT(Members10, 10)
+COUSCOUS_BENCH_STRUCT(Members100, 100)
+COUSCOUS_BENCH_STRUCT(Members250, 250)
+
+/**
+ * @brief Reads variable by runtime index through jump table
+ */
+template <class T> struct JumpTable {
+  static constexpr const char *name = "visit_member";
+
+  long long operator()(const T &obj, ::std::size_t index) const {
+    return reflect::utils::visit_member<T, reflect::ObjVars>(
+        obj, index, [](auto &&i, auto &&obj) -> long long {
+          return reflect::utils::invoke<T, reflect::ObjVars>(i, obj);
+        });
+  }
+};
+
+/**
+ * @brief Reads variable by runtime index comparing it with every index
+ */
+template <class T> struct LinearSearch {
+  static constexpr const char *name = "for_each";
+
+  long long operator()(const T &obj, ::std::size_t index) const {
+    long long result = 0;
+    reflect::metautils::for_each(
+        reflect::metautils::gen_inds_tup<decltype(
+            reflect::utils::count<T, reflect::ObjVars>())>(),
+        [&result, &obj, index](auto &&i) {
+          if (::std::decay_t<decltype(i)>::value ==
+              static_cast<long long>(index))
+            result = reflect::utils::invoke<T, reflect::ObjVars>(i, obj);
+          return 0;
+        });
+    return result;
+  }
+};
+
+/**
+ * @brief Measures time of reading variables by random indices
+ */
+template <class T, template <class> class Method> void measure() {
+  constexpr ::std::size_t count = reflect::utils::count<T>();
+  ::std::mt19937 generator(42);
+  ::std::uniform_int_distribution<::std::size_t> distribution(0, count - 1);
+  ::std::vector<::std::size_t> indices(COUSCOUS_BENCH_LOOKUPS);
+  for (auto &index : indices)
+    index = distribution(generator);
+  T obj;
+  Method<T> method;
+  long long sum = 0;
+  auto start = ::std::chrono::steady_clock::now();
+  for (auto index : indices)
+    sum += method(obj, index);
+  ::std::chrono::duration<double, ::std::nano> time =
+      ::std::chrono::steady_clock::now() - start;
+  ::std::printf("%-12s members=%-4zu %8.2f ns/lookup (checksum %lld)\n",
+                Method<T>::name, count, time.count() / indices.size(), sum);
+}
+
+int main() {
+  measure<Members10, JumpTable>();
+  measure<Members10, LinearSearch>();
+  measure<Members100, JumpTable>();
+  measure<Members100, LinearSearch>();
+  measure<Members250, JumpTable>();
+  measure<Members250, LinearSearch>();
+}
@@ -1,7 +1,8 @@
 #include <iostream>
 
 // Max length of a ct-string(also this parameter specifies maximum length of a
-// var/method name).
+// var/method name). It is used only by compilers which support neither C++20
+// string literal template parameters nor GNU string literal operator templates.
 // Default value: 64 (if STRING_MAXLEN isn't defined). It's important to define
 // it BEFORE include the reflection headers.
 #define STRING_MAXLEN 128
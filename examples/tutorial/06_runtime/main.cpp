@@ -0,0 +1,70 @@
+#include <iostream>
+#include <string>
+
+#include <reflect.hpp>
+
+namespace couscous {
+inline namespace runtime { using namespace ::reflect::runtime; }
+} // namespace couscous
+
+struct Config {
+  int port{80};
+  std::string host{"localhost"};
+  const int version{2};
+  void reload() {}
+  bool connect(const std::string &to) { return connect(to, port); }
+  bool connect(const std::string &to, int to_port) {
+    host = to;
+    port = to_port;
+    return true;
+  }
+  IN_METAINFO(Config)
+  REFLECT_OBJ_VAR(port)
+  REFLECT_OBJ_VAR(host)
+  REFLECT_OBJ_VAR(version)
+  REFLECT_OBJ_MTD(reload)
+  REFLECT_OBJ_MTD(connect, const std::string &)
+  REFLECT_OBJ_MTD(connect, const std::string &, int)
+};
+
+int main() {
+  // meta_object - runtime descriptor of reflected class. It is built once from
+  // compile-time metadata and doesn't allocate memory.
+  const couscous::MetaObject &meta = couscous::meta_object<Config>();
+  std::cout << "Class " << meta.name() << " has " << meta.size()
+            << " members" << std::endl;
+  // MetaObject is a flat array of MemberInfo descriptors (name, kind flags,
+  // offset, type id, getter and setter).
+  for (const couscous::MemberInfo &member : meta)
+    std::cout << member.name << '\t'
+              << (member.is(couscous::MemberInfo::Method) ? "method"
+                                                          : "variable")
+              << '\t' << (member.set ? "settable" : "read-only") << std::endl;
+  // Names known only at runtime are found by perfect hash computed at
+  // compile time.
+  std::string name = "port";
+  std::cout << "Index of " << name << ": " << meta.index_of(name) << std::endl;
+  // get/set check type of variable (type id) and return false on mismatch.
+  Config config;
+  int port = 0;
+  if (meta.get(config, name, port))
+    std::cout << "port = " << port << std::endl;
+  meta.set(config, "host", std::string("example.com"));
+  std::cout << "host = " << config.host << std::endl;
+  std::cout << "Set version: " << meta.set(config, "version", 3) << std::endl;
+  std::cout << "Set port to double: " << meta.set(config, "port", 1.0)
+            << std::endl;
+  // invoke_by_name - invokes method (or variable) by runtime name. Overload
+  // is chosen at compile time by types of arguments, result is converted to
+  // the second template parameter. Errors are returned as InvokeError.
+  couscous::InvokeResult<bool> connected =
+      couscous::invoke_by_name<Config, bool>(config, "connect", "127.0.0.1",
+                                             8080);
+  if (connected)
+    std::cout << "Connected to " << config.host << ':' << config.port
+              << std::endl;
+  auto missing = couscous::invoke_by_name<Config>(config, "disconnect");
+  std::cout << "Not found: "
+            << (missing.error() == couscous::InvokeError::NotFound)
+            << std::endl;
+}
@@ -3,22 +3,79 @@
 
 #include <cstddef>
 
+#ifndef COUNTER_BASE
+#define COUNTER_BASE 64 /**< base of compile-time counter */
+#endif
+
 namespace reflect {
 
 namespace metautils {
 
 /**
- * @brief Compile-time counter
+ * @brief Compile-time counter value. Doesn't inherit other values, so it is
+ * matched only exactly
  *
  */
-template <::std::size_t N = 255> struct counter : public counter<N - 1> {
+template <::std::size_t N> struct counter {
   static constexpr ::std::size_t value = N; /**< value of counter */
 };
+
+constexpr ::std::size_t counter_capacity =
+    ::std::size_t{COUNTER_BASE} * COUNTER_BASE; /**< maximum amount of values
+                                                   in compile-time counter */
+
+namespace detail {
+
+/**
+ * @brief High digit of compile-time counter. Counter value is stored as two
+ * digits in base COUNTER_BASE, so overload resolution walks at most
+ * COUNTER_BASE bases per digit instead of whole counter value
+ *
+ */
+template <::std::size_t H = COUNTER_BASE - 1>
+struct counter_digit : public counter_digit<H - 1> {
+  static constexpr ::std::size_t value = H; /**< value of digit */
+};
+
 /**
- * @brief Zero counter
+ * @brief Zero high digit
  *
  */
-template <> struct counter<0> { static constexpr ::std::size_t value = 0; };
+template <> struct counter_digit<0> {
+  static constexpr ::std::size_t value = 0;
+};
+
+template <::std::size_t N>
+using counter_high_t =
+    counter_digit<N / COUNTER_BASE>; /**< High digit of value N */
+
+template <::std::size_t N>
+using counter_low_t =
+    counter_digit<N % COUNTER_BASE>; /**< Low digit of value N */
+
+/**
+ * @brief Helper struct to get counter value from its digits
+ */
+template <class High, class Low> struct counter_value {
+  static_assert(High::value < COUNTER_BASE,
+                "Too many reflected elements, increase COUNTER_BASE");
+  using type = metautils::counter<High::value * COUNTER_BASE + Low::value>;
+};
+
+template <class High, class Low>
+using counter_value_t =
+    typename counter_value<High, Low>::type; /**< Helper type template for
+                                                counter_value */
+
+/**
+ * @brief Fallback for low digit lookup. Picked only when high digit H is
+ * already started, but no value was declared in it yet, returns last value of
+ * previous high digit
+ */
+template <::std::size_t H, class T>
+constexpr metautils::counter<H * COUNTER_BASE - 1>
+counter(metautils::counter<H>, counter_digit<0>, const T *);
+} // namespace detail
 } // namespace metautils
 } // namespace reflect
 
@@ -0,0 +1,304 @@
+#ifndef REFL_HASH_TRAITS_HPP
+#define REFL_HASH_TRAITS_HPP
+
+#include <array>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace reflect {
+
+namespace metautils {
+
+namespace detail {
+
+/**
+ * @brief FNV-1a hash of chars
+ * @return unsigned long long hash
+ */
+template <char... s> constexpr unsigned long long fnv1a_impl() {
+  unsigned long long hash = 14695981039346656037ull;
+  ((hash = (hash ^ static_cast<unsigned char>(s)) * 1099511628211ull), ...);
+  return hash;
+}
+
+/**
+ * @brief Mixes bits of hash with seed (splitmix64 finalizer)
+ * @return unsigned long long mixed hash
+ */
+constexpr unsigned long long mix_hash(unsigned long long hash,
+                                      unsigned long long seed) {
+  hash ^= seed * 0x9e3779b97f4a7c15ull;
+  hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+  hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+  return hash ^ (hash >> 31);
+}
+
+/**
+ * @brief Smallest power of two which is not less than value
+ */
+constexpr ::std::size_t ceil_pow2(::std::size_t value) {
+  ::std::size_t result = 1;
+  while (result < value)
+    result <<= 1;
+  return result;
+}
+} // namespace detail
+
+/**
+ * @brief FNV-1a hash of string, equal to ct_string_hash_v of the same ct-string
+ * @param str - string
+ * @return unsigned long long hash
+ */
+constexpr unsigned long long string_hash(::std::string_view str) {
+  unsigned long long hash = 14695981039346656037ull;
+  for (char c : str)
+    hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+  return hash;
+}
+
+/**
+ * @brief Hash of bytes, bytes are mixed by 8 at once
+ * @param data - pointer to bytes
+ * @param size - amount of bytes
+ * @param seed - initial hash
+ * @return unsigned long long hash
+ */
+inline unsigned long long bytes_hash(const void *data, ::std::size_t size,
+                                     unsigned long long seed = 0) {
+  const unsigned char *bytes = static_cast<const unsigned char *>(data);
+  unsigned long long hash = seed ^ size;
+  for (; size >= sizeof(::std::uint64_t); size -= sizeof(::std::uint64_t),
+                                          bytes += sizeof(::std::uint64_t)) {
+    ::std::uint64_t word;
+    ::std::memcpy(&word, bytes, sizeof(word));
+    hash = detail::mix_hash(word, hash);
+  }
+  if (size > 0) {
+    ::std::uint64_t word = 0;
+    ::std::memcpy(&word, bytes, size);
+    hash = detail::mix_hash(word, hash);
+  }
+  return hash;
+}
+
+/**
+ * @brief Compile-time hash of ct-string
+ */
+template <class String> struct ct_string_hash;
+
+/**
+ * @brief Compile-time hash of ct-string (template spetialization for
+ * boost::hana::string)
+ */
+template <char... s> struct ct_string_hash<::boost::hana::string<s...>> {
+  static constexpr unsigned long long value =
+      detail::fnv1a_impl<s...>(); /**< FNV-1a hash of chars */
+};
+
+template <class String>
+constexpr unsigned long long ct_string_hash_v =
+    ct_string_hash<String>::value; /**< Helper variable template for
+                                      ct_string_hash */
+
+/**
+ * @brief Hashes of all ct-strings in tuple
+ * @param boost::hana::tuple<Strings...> - tuple of ct-strings
+ * @return std::array of hashes
+ */
+template <class... Strings>
+constexpr decltype(auto)
+ct_string_hashes(const ::boost::hana::tuple<Strings...> &) {
+  return ::std::array<unsigned long long, sizeof...(Strings)>{
+      {ct_string_hash_v<Strings>...}};
+}
+
+/**
+ * @brief Views of all ct-strings in tuple
+ * @param boost::hana::tuple<Strings...> - tuple of ct-strings
+ * @return std::array of std::string_view
+ */
+template <class... Strings>
+constexpr decltype(auto)
+ct_string_views(const ::boost::hana::tuple<Strings...> &) {
+  return ::std::array<::std::string_view, sizeof...(Strings)>{
+      {::std::string_view(Strings::c_str())...}};
+}
+
+/**
+ * @brief Hash table of N precomputed hashes, elements are bucketed by hash, so
+ * lookup checks only elements of one bucket
+ */
+template <::std::size_t N> class hash_table final {
+public:
+  static constexpr ::std::size_t buckets = N > 0 ? N : 1; /**< Amount of
+                                                             buckets */
+
+  /**
+   * @brief Distributes elements over buckets (stable, so elements of a bucket
+   * are ordered by index)
+   * @param hashes - hash of every element
+   */
+  constexpr hash_table(const ::std::array<unsigned long long, N> &hashes)
+      : hashes_(hashes) {
+    for (::std::size_t i = 0; i < N; ++i)
+      ++begin_[hashes_[i] % buckets + 1];
+    for (::std::size_t bucket = 0; bucket < buckets; ++bucket)
+      begin_[bucket + 1] += begin_[bucket];
+    ::std::array<::std::size_t, buckets + 1> position = begin_;
+    for (::std::size_t i = 0; i < N; ++i)
+      order_[position[hashes_[i] % buckets]++] = static_cast<long long>(i);
+  }
+
+  /**
+   * @brief Amount of elements with given hash
+   * @param hash - hash to find
+   * @return std::size_t amount of elements
+   */
+  constexpr ::std::size_t count(unsigned long long hash) const {
+    ::std::size_t result = 0;
+    for (::std::size_t i = begin_[hash % buckets];
+         i < begin_[hash % buckets + 1]; ++i)
+      if (hashes_[order_[i]] == hash)
+        ++result;
+    return result;
+  }
+
+  /**
+   * @brief Indices of elements with given hash
+   * @param hash - hash to find
+   * @return std::array of M indices in ascending order, M must be equal to
+   * count(hash)
+   */
+  template <::std::size_t M>
+  constexpr ::std::array<long long, M> find(unsigned long long hash) const {
+    ::std::array<long long, M> result{};
+    for (::std::size_t i = begin_[hash % buckets], position = 0;
+         i < begin_[hash % buckets + 1]; ++i)
+      if (hashes_[order_[i]] == hash)
+        result[position++] = order_[i];
+    return result;
+  }
+
+private:
+  ::std::array<unsigned long long, N> hashes_{}; /**< hash of every element */
+  ::std::array<::std::size_t, buckets + 1> begin_{}; /**< position of first
+                                                        element of every bucket
+                                                        in order_ */
+  ::std::array<long long, N> order_{}; /**< indices of elements grouped by
+                                          bucket */
+};
+
+/**
+ * @brief Perfect hash of N precomputed hashes (hash and displace).
+ * Elements with equal hashes are treated as one key, which maps to the first of
+ * them. Lookup costs one bucket read and one slot read
+ */
+template <::std::size_t N> class perfect_hash final {
+public:
+  static constexpr ::std::uint32_t npos =
+      static_cast<::std::uint32_t>(-1); /**< Element is not found */
+  static constexpr ::std::size_t buckets = N > 0 ? N : 1; /**< Amount of
+                                                             buckets */
+  static constexpr ::std::size_t capacity =
+      detail::ceil_pow2(2 * buckets); /**< Amount of slots (power of two) */
+
+  /**
+   * @brief Finds displacement of every bucket, so keys of all buckets are
+   * placed into distinct slots. Buckets with more keys are placed first
+   * @param hashes - hash of every element
+   */
+  constexpr perfect_hash(const ::std::array<unsigned long long, N> &hashes)
+      : hashes_(hashes) {
+    ::std::array<::std::size_t, buckets + 1> begin{};
+    ::std::array<::std::size_t, N> order{};
+    ::std::array<::std::size_t, buckets> keys{};
+    for (::std::size_t i = 0; i < N; ++i)
+      ++begin[hashes_[i] % buckets + 1];
+    for (::std::size_t bucket = 0; bucket < buckets; ++bucket)
+      begin[bucket + 1] += begin[bucket];
+    ::std::array<::std::size_t, buckets + 1> position = begin;
+    for (::std::size_t i = 0; i < N; ++i) {
+      ::std::size_t bucket = hashes_[i] % buckets;
+      bool duplicate = false;
+      for (::std::size_t j = begin[bucket]; j < position[bucket]; ++j)
+        duplicate = duplicate || hashes_[order[j]] == hashes_[i];
+      if (!duplicate) {
+        order[position[bucket]++] = i;
+        ++keys[bucket];
+      }
+    }
+    for (::std::size_t i = 0; i < capacity; ++i)
+      slot_[i] = npos;
+    ::std::size_t max_keys = 0;
+    for (::std::size_t bucket = 0; bucket < buckets; ++bucket)
+      max_keys = keys[bucket] > max_keys ? keys[bucket] : max_keys;
+    for (::std::size_t size = max_keys; size > 0; --size)
+      for (::std::size_t bucket = 0; bucket < buckets; ++bucket)
+        if (keys[bucket] == size)
+          place(begin[bucket], begin[bucket] + size, order, bucket);
+  }
+
+  /**
+   * @brief Index of element with given hash
+   * @param hash - hash to find
+   * @return index of element or npos, if no element has such hash
+   */
+  constexpr ::std::uint32_t find(unsigned long long hash) const {
+    ::std::uint32_t index = slot_[slot(hash, displacement_[hash % buckets])];
+    return index != npos && hashes_[index] == hash ? index : npos;
+  }
+
+private:
+  /**
+   * @brief Slot of key
+   * @param hash - hash of key
+   * @param displacement - displacement of bucket of key
+   * @return std::size_t slot index
+   */
+  static constexpr ::std::size_t slot(unsigned long long hash,
+                                      ::std::uint32_t displacement) {
+    return detail::mix_hash(hash, displacement) & (capacity - 1);
+  }
+
+  /**
+   * @brief Finds displacement of bucket and places its keys
+   * @param first - position of first key of bucket in order
+   * @param last - position after last key of bucket in order
+   * @param order - indices of keys grouped by bucket
+   * @param bucket - bucket index
+   */
+  constexpr void place(::std::size_t first, ::std::size_t last,
+                       const ::std::array<::std::size_t, N> &order,
+                       ::std::size_t bucket) {
+    for (::std::uint32_t displacement = 0;; ++displacement) {
+      bool placed = true;
+      for (::std::size_t i = first; placed && i < last; ++i) {
+        ::std::size_t current = slot(hashes_[order[i]], displacement);
+        placed = slot_[current] == npos;
+        for (::std::size_t j = first; placed && j < i; ++j)
+          placed = current != slot(hashes_[order[j]], displacement);
+      }
+      if (placed) {
+        displacement_[bucket] = displacement;
+        for (::std::size_t i = first; i < last; ++i)
+          slot_[slot(hashes_[order[i]], displacement)] =
+              static_cast<::std::uint32_t>(order[i]);
+        return;
+      }
+    }
+  }
+
+  ::std::array<unsigned long long, N> hashes_{}; /**< hash of every element */
+  ::std::array<::std::uint32_t, buckets> displacement_{}; /**< displacement of
+                                                             every bucket */
+  ::std::array<::std::uint32_t, capacity> slot_{}; /**< element index of every
+                                                   slot */
+};
+} // namespace metautils
+} // namespace reflect
+
+#endif // REFL_HASH_TRAITS_HPP
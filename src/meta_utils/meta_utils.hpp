@@ -3,6 +3,7 @@
 
 #include "ct_counter.hpp"
 #include "function_traits.hpp"
+#include "hash_traits.hpp"
 #include "string_traits.hpp"
 #include "tuple_traits.hpp"
 #include "type_traits.hpp"
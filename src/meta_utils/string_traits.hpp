@@ -8,6 +8,8 @@
 #include <boost/hana/string.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/preprocessor/repetition/repeat.hpp>
+#include <type_traits>
+#include <utility>
 
 namespace reflect {
 
@@ -67,6 +69,96 @@ constexpr decltype(auto) remove_zeros_from_ct_string(const T str) {
 } // namespace metautils
 } // namespace reflect
 
+#if defined(__cpp_nontype_template_args) &&                                    \
+    __cpp_nontype_template_args >= 201911L
+
+namespace reflect {
+
+namespace metautils {
+
+/**
+ * @brief String literal which can be passed as template parameter
+ *
+ */
+template <::std::size_t N> struct fixed_string {
+  /**
+   * @brief Copies string literal
+   * @param str - string literal
+   */
+  constexpr fixed_string(const char (&str)[N]) {
+    for (::std::size_t i = 0; i < N; ++i)
+      data[i] = str[i];
+  }
+
+  char data[N]{}; /**< chars of string literal with ending zero */
+};
+
+namespace detail {
+
+/**
+ * @brief generate ct-string from chars of fixed_string
+ * @param std::index_sequence<Indices...> indices of chars (without ending zero)
+ * @return boost::hana::string - ct-string
+ */
+template <fixed_string S, ::std::size_t... Indices>
+constexpr auto ct_string_impl(::std::index_sequence<Indices...>) {
+  return ::boost::hana::string_c<S.data[Indices]...>;
+}
+} // namespace detail
+
+template <fixed_string S>
+using ct_string_t = decltype(detail::ct_string_impl<S>(
+    ::std::make_index_sequence<sizeof(S.data) -
+                               1>())); /**< ct-string type created from string
+                                          literal S */
+} // namespace metautils
+} // namespace reflect
+
+/**
+ * @brief Creates boost::hana::string from string literal passed as template
+ * parameter
+ */
+#define HANA_STR(str)                                                          \
+  ::reflect::metautils::ct_string_t<str> {                                     \
+  } /**<constexpr compile-time string */
+
+#elif defined(__GNUC__)
+
+#pragma GCC diagnostic push
+#if defined(__clang__)
+#pragma clang diagnostic ignored "-Wgnu-string-literal-operator-template"
+#else
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+/**
+ * @brief Creates boost::hana::string from string literal with GNU string
+ * literal operator template extension
+ * @return boost::hana::string - ct-string
+ */
+template <class CharT, CharT... s>
+constexpr ::boost::hana::string<s...> operator""_couscous_str() {
+  static_assert(::std::is_same_v<CharT, char>,
+                "Only narrow string literals are supported");
+  return {};
+}
+
+#pragma GCC diagnostic pop
+
+/**
+ * @brief Appends literal suffix to string literal. Separate macro is needed to
+ * expand stringized argument before concatenation
+ */
+#define HANA_STR_IMPL(str) str##_couscous_str
+
+/**
+ * @brief Creates boost::hana::string from string literal with GNU string
+ * literal operator template extension
+ */
+#define HANA_STR(str) HANA_STR_IMPL(str) /**<constexpr compile-time string */
+
+#else
+
 #ifndef STRING_MAXLEN
 #define STRING_MAXLEN 64 /**< maximum length of compile-time string */
 #endif
@@ -91,4 +183,6 @@ constexpr decltype(auto) remove_zeros_from_ct_string(const T str) {
       ::boost::hana::string_c<CT_STR(                                          \
           str)>) /**<constexpr compile-time string */
 
+#endif
+
 #endif // STRING_TRAITS_HPP
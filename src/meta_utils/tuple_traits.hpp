@@ -2,55 +2,126 @@
 #define REFL_TUPLE_TRAITS_HPP
 
 #include "type_traits.hpp"
-#include <boost/hana/concat.hpp>
+#include <array>
+#include <boost/hana/basic_tuple.hpp>
 #include <boost/hana/size.hpp>
 #include <boost/hana/tuple.hpp>
+#include <utility>
 
 namespace reflect {
 
 namespace metautils {
 
+template <long long Index, class Tuple>
+using tuple_item_t = ::std::decay_t<decltype(::boost::hana::at_c<Index>(
+    ::std::declval<Tuple>()))>; /**< Decayed type of tuple element */
+
+namespace detail {
+
 /**
- * @brief Concatenating multiple tuples into one
+ * @brief Positions of elements of concatenated tuple in source tuples
+ * @param outer - true to get indices of source tuples, false to get indices of
+ * elements in source tuples
+ * @return std::array of indices, one per element of concatenated tuple
  */
-constexpr decltype(auto) multiple_concat() {
-  return ::boost::hana::make_tuple();
+template <::std::size_t... Sizes>
+constexpr decltype(auto) concat_positions(bool outer) {
+  constexpr ::std::size_t sizes[] = {Sizes..., 0};
+  ::std::array<::std::size_t, (::std::size_t{0} + ... + Sizes)> result{};
+  for (::std::size_t tuple = 0, position = 0; tuple < sizeof...(Sizes);
+       ++tuple)
+    for (::std::size_t element = 0; element < sizes[tuple]; ++element)
+      result[position++] = outer ? tuple : element;
+  return result;
 }
 
-template <class T> constexpr decltype(auto) multiple_concat(T &&value) {
-  return ::boost::hana::concat(::std::forward<T>(value), multiple_concat());
+/**
+ * @brief Concatenating multiple tuples implementation, every element is taken
+ * directly from its source tuple
+ * @param std::index_sequence<Positions...> - positions in concatenated tuple
+ * @param tuples - template pack of boost::hana::tuple
+ */
+template <::std::size_t... Positions, class... Tuples>
+constexpr decltype(auto)
+multiple_concat_impl(::std::index_sequence<Positions...> &&,
+                     Tuples &&... tuples) {
+  [[maybe_unused]] constexpr auto outer = concat_positions<decltype(
+      ::boost::hana::size(::std::declval<Tuples>()))::value...>(true);
+  [[maybe_unused]] constexpr auto inner = concat_positions<decltype(
+      ::boost::hana::size(::std::declval<Tuples>()))::value...>(false);
+  [[maybe_unused]] auto storage =
+      ::boost::hana::make_basic_tuple(::std::forward<Tuples>(tuples)...);
+  return ::boost::hana::make_tuple(::boost::hana::at_c<inner[Positions]>(
+      ::boost::hana::at_c<outer[Positions]>(::std::move(storage)))...);
 }
 
 /**
- * @brief Concating multiple tuples into one
- *
- * @param value boost::hana::tuple
- * @param args template pack of boost::hana::tuple
- * @return concatenated tuple
+ * @brief Positions of true values in mask
+ * @return std::array of positions
  */
-template <class T, class... Args>
-constexpr decltype(auto) multiple_concat(T &&value, Args &&... args) {
-  return ::boost::hana::concat(::std::forward<T>(value),
-                               multiple_concat(::std::forward<Args>(args)...));
+template <bool... Mask> constexpr decltype(auto) mask_positions() {
+  constexpr bool mask[] = {Mask..., false};
+  ::std::array<::std::size_t, (::std::size_t{0} + ... + ::std::size_t{Mask})>
+      result{};
+  for (::std::size_t i = 0, position = 0; i < sizeof...(Mask); ++i)
+    if (mask[i])
+      result[position++] = i;
+  return result;
 }
 
-namespace detail {
+/**
+ * @brief Select indices by mask implementation
+ * @param std::integer_sequence<bool, Mask...> - mask of selected indices
+ * @param std::index_sequence<Positions...> - positions in result tuple
+ */
+template <long long... Indices, bool... Mask, ::std::size_t... Positions>
+constexpr decltype(auto)
+filter_indices_impl(::std::integer_sequence<bool, Mask...> &&,
+                    ::std::index_sequence<Positions...> &&) {
+  [[maybe_unused]] constexpr long long indices[] = {Indices..., 0};
+  [[maybe_unused]] constexpr auto positions = mask_positions<Mask...>();
+  return ::boost::hana::tuple<
+      ::boost::hana::llong<indices[positions[Positions]]>...>{};
+}
+} // namespace detail
 
 /**
- * @brief Compare types index implementation
+ * @brief Concating multiple tuples into one. Positions of all elements are
+ * computed in one pass, so concatenation of N elements costs O(N)
+ * instantiations
  *
- * @param A type A
- * @param B type B
- * @return tuple of index if A and B same type or empty tuple
+ * @param tuples template pack of boost::hana::tuple
+ * @return concatenated tuple
  */
-template <long long Index, class A, class B>
-constexpr decltype(auto) compare_types_index_impl(A &&, B &&) {
-  if constexpr (::std::is_same_v<::std::decay_t<A>, ::std::decay_t<B>>)
-    return ::boost::hana::tuple_c<long long, Index>;
-  else
-    return ::boost::hana::make_tuple();
+template <class... Tuples>
+constexpr decltype(auto) multiple_concat(Tuples &&... tuples) {
+  return detail::multiple_concat_impl(
+      ::std::make_index_sequence<(
+          ::std::size_t{0} + ... +
+          decltype(::boost::hana::size(::std::declval<Tuples>()))::value)>(),
+      ::std::forward<Tuples>(tuples)...);
+}
+
+/**
+ * @brief Select indices by mask
+ * @param std::integer_sequence<bool, Mask...> - mask, true if index is selected
+ * @param boost::hana::tuple<boost::hana::llong<Indices>...> - indices
+ * @return boost::hana::tuple of selected indices
+ */
+template <bool... Mask, long long... Indices>
+constexpr decltype(auto) filter_indices(
+    ::std::integer_sequence<bool, Mask...> &&mask,
+    const ::boost::hana::tuple<::boost::hana::llong<Indices>...> &) {
+  static_assert(sizeof...(Mask) == sizeof...(Indices),
+                "Mask size must be equal to amount of indices");
+  return detail::filter_indices_impl<Indices...>(
+      ::std::move(mask),
+      ::std::make_index_sequence<(::std::size_t{0} + ... +
+                                  ::std::size_t{Mask})>());
 }
 
+namespace detail {
+
 /**
  * @brief Find same type of object in tuple implementation
  *
@@ -60,11 +131,13 @@ constexpr decltype(auto) compare_types_index_impl(A &&, B &&) {
  */
 template <class T, class Tp, long long... Indices>
 constexpr decltype(auto)
-find_values_args_impl(::std::integer_sequence<long long, Indices...> &&,
-                      T &&value, Tp &&tup) {
-  return metautils::multiple_concat(compare_types_index_impl<Indices>(
-      ::std::forward<T>(value),
-      ::boost::hana::at_c<Indices>(::std::forward<Tp>(tup)))...);
+find_values_args_impl(::std::integer_sequence<long long, Indices...> &&, T &&,
+                      Tp &&) {
+  return metautils::filter_indices(
+      ::std::integer_sequence<
+          bool,
+          ::std::is_same_v<::std::decay_t<T>, tuple_item_t<Indices, Tp>>...>(),
+      ::boost::hana::tuple_c<long long, Indices...>);
 }
 
 /**
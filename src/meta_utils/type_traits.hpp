@@ -2,6 +2,13 @@
 #define REFL_TYPE_TRAITS_HPP
 
 #include <boost/hana/type.hpp>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#if __has_include(<span>)
+#include <span>
+#endif
 
 namespace reflect {
 
@@ -43,6 +50,64 @@ constexpr bool is_reference_wrapper_v =
     is_reference_wrapper<T>::value; /**< Helper variable template for
                                        is_reference_wrapper */
 
+/**
+ * @brief Check if type is std::basic_string
+ */
+template <class T> struct is_string : ::std::false_type {};
+
+/**
+ * @brief Check if type is std::basic_string (template spetialization for
+ * std::basic_string)
+ */
+template <class CharT, class Traits, class Allocator>
+struct is_string<::std::basic_string<CharT, Traits, Allocator>>
+    : ::std::true_type {};
+
+template <class T>
+constexpr bool is_string_v =
+    is_string<T>::value; /**< Helper variable template for is_string */
+
+/**
+ * @brief Check if type is std::vector
+ */
+template <class T> struct is_vector : ::std::false_type {};
+
+/**
+ * @brief Check if type is std::vector (template spetialization for
+ * std::vector)
+ */
+template <class T, class Allocator>
+struct is_vector<::std::vector<T, Allocator>> : ::std::true_type {};
+
+template <class T>
+constexpr bool is_vector_v =
+    is_vector<T>::value; /**< Helper variable template for is_vector */
+
+/**
+ * @brief Check if type is view of memory it doesn't own (std::basic_string_view
+ * or std::span)
+ */
+template <class T> struct is_view : ::std::false_type {};
+
+/**
+ * @brief Check if type is view (template spetialization for
+ * std::basic_string_view)
+ */
+template <class CharT, class Traits>
+struct is_view<::std::basic_string_view<CharT, Traits>> : ::std::true_type {};
+
+#if defined(__cpp_lib_span)
+/**
+ * @brief Check if type is view (template spetialization for std::span)
+ */
+template <class T, ::std::size_t Extent>
+struct is_view<::std::span<T, Extent>> : ::std::true_type {};
+#endif
+
+template <class T>
+constexpr bool is_view_v =
+    is_view<T>::value; /**< Helper variable template for is_view */
+
 /**
  * @brief Helper struct to unpack type typename from class if it exists
  */
@@ -61,6 +126,25 @@ using unpack_type_typename_helper_t =
     typename unpack_type_typename_helper<T>::type; /**<
                                    Helper type template for
                                    unpack_type_typename_helper */
+
+/**
+ * @brief Type of member of pointer to member (function type with cv, ref and
+ * noexcept qualifiers for pointer to method)
+ */
+template <class T> struct member_pointer_type;
+
+/**
+ * @brief Type of member of pointer to member (template spetialization for
+ * pointer to member)
+ */
+template <class T, class C> struct member_pointer_type<T C::*> {
+  using type = T;
+};
+
+template <class T>
+using member_pointer_type_t =
+    typename member_pointer_type<T>::type; /**< Helper type template for
+                                              member_pointer_type */
 } // namespace metautils
 } // namespace reflect
 
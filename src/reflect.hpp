@@ -2,22 +2,25 @@
 #define REFLECT_HPP
 
 #include "meta_utils/meta_utils.hpp"
+#include "reflect_containers/reflect_aggregate.hpp"
+#include "reflect_containers/reflect_soa.hpp"
+#include "reflect_containers/reflect_tracked.hpp"
 #include "reflect_information/reflect_information.hpp"
+#include "reflect_runtime/reflect_runtime.hpp"
+#include "reflect_serialization/reflect_binary.hpp"
+#include "reflect_serialization/reflect_delta.hpp"
+#include "reflect_serialization/reflect_json.hpp"
+#include "reflect_serialization/reflect_json_stream.hpp"
 #include "reflect_utils/reflect_utils.hpp"
 
 /**
  * @brief Reflection namespace
  * @todo add old examples
- * @todo serialization examples (console, json)
  * @todo performance benchmarks
- * @todo compile time benchmarks
- * @todo memorization
- * @todo Runtime reflection
  * @todo Reflect constructors
  * @todo Signals
  * @todo Slots
  * @todo Parameters
- * @todo Enums
  */
 namespace reflect {
 
@@ -33,6 +36,19 @@ using ConstMethods =
 using StaticMethods =
     info::StaticIndexGenerator<AllMethods>; /**< Static methods */
 
+template <class... Generators>
+using And = info::And<Generators...>; /**< Items selected by all generators */
+template <class... Generators>
+using Or = info::Or<Generators...>; /**< Items selected by any generator */
+template <class Generator>
+using Not = info::Not<Generator>; /**< Items not selected by generator */
+template <template <class> class Pred>
+using ByType = info::ByType<Pred>; /**< Items which type satisfies Pred */
+
+template <class T>
+using tracked =
+    containers::tracked<T>; /**< Object which records written variables */
+
 } // namespace reflect
 
 #endif // UTILS_HPP
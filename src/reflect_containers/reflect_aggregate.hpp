@@ -0,0 +1,372 @@
+#ifndef REFLECT_AGGREGATE_HPP
+#define REFLECT_AGGREGATE_HPP
+
+#include "../meta_utils/meta_utils.hpp"
+#include "../reflect_information/reflect_information.hpp"
+#include "../reflect_utils/reflect_utils.hpp"
+#include "reflect_soa.hpp"
+#include <algorithm>
+#include <boost/hana/at.hpp>
+#include <boost/hana/tuple.hpp>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace reflect {
+
+namespace containers {
+
+/**
+ * @brief Reductions of one arithmetic object variable
+ */
+template <class V> struct field_stats {
+  using value_type = V; /**< Type of object variable */
+  using sum_type = ::std::conditional_t<
+      ::std::is_floating_point_v<V>, ::std::common_type_t<V, double>,
+      ::std::conditional_t<::std::is_signed_v<V>, long long,
+                           unsigned long long>>; /**< Type of sum */
+
+  static constexpr V min_sentinel =
+      ::std::numeric_limits<V>::has_infinity
+          ? ::std::numeric_limits<V>::infinity()
+          : ::std::numeric_limits<V>::max(); /**< Initial min, not less than
+                                                any value */
+  static constexpr V max_sentinel =
+      ::std::numeric_limits<V>::has_infinity
+          ? -::std::numeric_limits<V>::infinity()
+          : ::std::numeric_limits<V>::lowest(); /**< Initial max, not greater
+                                                   than any value */
+
+  ::std::size_t count{0}; /**< Amount of values */
+  sum_type sum{0};        /**< Sum of values */
+  V min{min_sentinel};    /**< Minimal value (min_sentinel if count == 0) */
+  V max{max_sentinel};    /**< Maximal value (max_sentinel if count == 0) */
+
+  /**
+   * @brief Mean of values (0 if there are no values)
+   */
+  double mean() const noexcept {
+    return count > 0 ? static_cast<double>(sum) / count : 0;
+  }
+
+  /**
+   * @brief Adds value
+   * @param value - value of object variable
+   */
+  void add(V value) noexcept {
+    ++count;
+    sum += value;
+    min = value < min ? value : min;
+    max = max < value ? value : max;
+  }
+
+  /**
+   * @brief Adds reductions of other values
+   * @param other - reductions of other values
+   */
+  void merge(const field_stats &other) noexcept {
+    count += other.count;
+    sum += other.sum;
+    min = other.min < min ? other.min : min;
+    max = max < other.max ? other.max : max;
+  }
+};
+
+namespace detail {
+
+/**
+ * @brief Checks if type of object variable can be aggregated (arithmetic type
+ * except bool)
+ */
+template <class V>
+struct is_aggregatable
+    : ::std::bool_constant<::std::is_arithmetic_v<V> &&
+                           !::std::is_same_v<V, bool>> {};
+
+template <class Generator>
+using aggregated_t =
+    info::And<Generator, ObjVars,
+              info::ByType<is_aggregatable>>; /**< Arithmetic object variables
+                                                 selected by Generator */
+
+/**
+ * @brief Reductions of all aggregated variables
+ * @param std::index_sequence<Positions...> - positions of aggregated variables
+ * @return boost::hana::tuple of field_stats
+ */
+template <class T, class Generator, ::std::size_t... Positions>
+constexpr decltype(auto) make_stats(::std::index_sequence<Positions...> &&) {
+  return ::boost::hana::tuple<field_stats<info::item_value_t<
+      utils::selected_item_t<T, aggregated_t<Generator>,
+                             ::boost::hana::llong<Positions>>>>...>{};
+}
+
+template <class T, class Generator>
+using stats_t = ::std::decay_t<decltype(make_stats<T, Generator>(
+    ::std::make_index_sequence<utils::selected_count_v<
+        T, aggregated_t<Generator>>>()))>; /**< Reductions of aggregated
+                                              variables of T */
+
+constexpr ::std::size_t lanes = 4; /**< Amount of independent accumulators of
+                                      column reduction */
+
+constexpr ::std::size_t min_chunk = 1 << 14; /**< Minimal amount of elements
+                                                reduced by one thread */
+
+/**
+ * @brief Reduces contiguous column. Every lane has its own accumulators, so
+ * loop has no dependency between iterations and is vectorized
+ * @param data - pointer to first value
+ * @param size - amount of values
+ */
+template <class V>
+field_stats<V> reduce_column(const V *data, ::std::size_t size) noexcept {
+  using Sum = typename field_stats<V>::sum_type;
+  Sum sums[lanes]{};
+  V mins[lanes];
+  V maxs[lanes];
+  ::std::fill(mins, mins + lanes, field_stats<V>::min_sentinel);
+  ::std::fill(maxs, maxs + lanes, field_stats<V>::max_sentinel);
+  ::std::size_t i = 0;
+  for (; i + lanes <= size; i += lanes)
+    for (::std::size_t lane = 0; lane < lanes; ++lane) {
+      const V value = data[i + lane];
+      sums[lane] += value;
+      mins[lane] = value < mins[lane] ? value : mins[lane];
+      maxs[lane] = maxs[lane] < value ? value : maxs[lane];
+    }
+  field_stats<V> stats;
+  for (::std::size_t lane = 0; lane < lanes; ++lane) {
+    stats.sum += sums[lane];
+    stats.min = mins[lane] < stats.min ? mins[lane] : stats.min;
+    stats.max = stats.max < maxs[lane] ? maxs[lane] : stats.max;
+  }
+  stats.count = i;
+  for (; i < size; ++i)
+    stats.add(data[i]);
+  return stats;
+}
+
+/**
+ * @brief Calls reduce for [0, size) split into chunks, chunks are reduced by
+ * separate threads and merged
+ * @param size - amount of elements
+ * @param threads - maximal amount of threads (0 - hardware concurrency)
+ * @param reduce - function (begin, end) -> Result, Result has merge
+ * @return Result
+ */
+template <class Result, class Reduce>
+Result reduce_parallel(::std::size_t size, ::std::size_t threads,
+                       Reduce &&reduce) {
+  if (threads == 0)
+    threads = ::std::max(1u, ::std::thread::hardware_concurrency());
+  threads = ::std::min(threads, size / min_chunk);
+  if (threads <= 1)
+    return reduce(::std::size_t{0}, size);
+  ::std::vector<Result> results(threads);
+  ::std::vector<::std::thread> workers;
+  workers.reserve(threads - 1);
+  const ::std::size_t chunk = size / threads;
+  try {
+    for (::std::size_t i = 1; i < threads; ++i)
+      workers.emplace_back([&results, &reduce, i, chunk, threads, size] {
+        results[i] =
+            reduce(i * chunk, i + 1 == threads ? size : (i + 1) * chunk);
+      });
+    results[0] = reduce(::std::size_t{0}, chunk);
+  } catch (...) {
+    // started threads are joinable, destroying them would call terminate
+    for (auto &worker : workers)
+      worker.join();
+    throw;
+  }
+  for (auto &worker : workers)
+    worker.join();
+  for (::std::size_t i = 1; i < threads; ++i)
+    results[0].merge(results[i]);
+  return results[0];
+}
+} // namespace detail
+
+/**
+ * @brief Sum, min, max and mean of every arithmetic object variable (including
+ * inherited ones, except bool) selected by the generator
+ */
+template <class T, class Generator = info::DefaultIndexGenerator>
+class aggregates final {
+public:
+  using generator =
+      detail::aggregated_t<Generator>; /**< Generator of aggregated variables,
+                                          positions and names are relative to
+                                          it */
+  using stats_type =
+      detail::stats_t<T, Generator>; /**< boost::hana::tuple of field_stats */
+
+  static constexpr ::std::size_t fields_count =
+      utils::selected_count_v<T, generator>; /**< Amount of aggregated
+                                                variables */
+
+  /**
+   * @brief Reductions of variable by position
+   * @return field_stats
+   */
+  template <long long I> decltype(auto) get() noexcept {
+    return (::boost::hana::at_c<I>(stats_));
+  }
+
+  /**
+   * @brief Reductions of variable by position
+   * @return const field_stats
+   */
+  template <long long I> decltype(auto) get() const noexcept {
+    return (::boost::hana::at_c<I>(stats_));
+  }
+
+  /**
+   * @brief Reductions of variable by name
+   * @param str - ct-string (boost::hana::string)
+   * @return const field_stats
+   */
+  template <class String> decltype(auto) operator[](String &&str) const {
+    return get<::std::decay_t<decltype(utils::find_by_name_first<T, generator>(
+        ::std::forward<String>(str)))>::value>();
+  }
+
+  /**
+   * @brief Adds variables of object
+   * @param obj - object
+   */
+  void add(const T &obj) noexcept {
+    add_impl(obj, ::std::make_index_sequence<fields_count>());
+  }
+
+  /**
+   * @brief Adds reductions of other objects
+   * @param other - reductions of other objects
+   */
+  void merge(const aggregates &other) noexcept {
+    merge_impl(other, ::std::make_index_sequence<fields_count>());
+  }
+
+private:
+  /**
+   * @brief Adds variables of object
+   * @param std::index_sequence<Positions...> - positions of variables
+   */
+  template <::std::size_t... Positions>
+  void add_impl(const T &obj, ::std::index_sequence<Positions...> &&) noexcept {
+    (::boost::hana::at_c<Positions>(stats_).add(utils::invoke<T, generator>(
+         ::boost::hana::llong_c<Positions>, obj)),
+     ...);
+  }
+
+  /**
+   * @brief Adds reductions of other objects
+   * @param std::index_sequence<Positions...> - positions of variables
+   */
+  template <::std::size_t... Positions>
+  void merge_impl(const aggregates &other,
+                  ::std::index_sequence<Positions...> &&) noexcept {
+    (::boost::hana::at_c<Positions>(stats_).merge(
+         ::boost::hana::at_c<Positions>(other.stats_)),
+     ...);
+  }
+
+  stats_type stats_; /**< Reductions of every aggregated variable */
+};
+
+namespace detail {
+
+/**
+ * @brief Reduces columns of soa_vector in [begin, end)
+ * @param std::index_sequence<Positions...> - positions of aggregated variables
+ */
+template <class T, class Generator, ::std::size_t... Positions>
+aggregates<T, Generator>
+reduce_columns(const soa_vector<T> &soa, ::std::size_t begin, ::std::size_t end,
+               ::std::index_sequence<Positions...> &&) noexcept {
+  using Aggregated = aggregated_t<Generator>;
+  aggregates<T, Generator> result;
+  ((result.template get<Positions>() = reduce_column(
+        soa.template column<position_v<
+               T, decltype(utils::member_name<T, Aggregated>(
+                      ::boost::hana::llong_c<Positions>))>>()
+                .data() +
+            begin,
+        end - begin)),
+   ...);
+  return result;
+}
+} // namespace detail
+
+/**
+ * @brief Aggregates arithmetic object variables of objects in one pass over
+ * range
+ * @param range - range of T (e.g. std::vector<T>), must have random access
+ * iterators if threads != 1
+ * @param threads - maximal amount of threads, every thread reduces at least
+ * 16384 objects (0 - hardware concurrency)
+ * @return aggregates<T, Generator>
+ */
+template <class T, class Generator = info::DefaultIndexGenerator, class Range>
+aggregates<T, Generator> aggregate(const Range &range,
+                                   ::std::size_t threads = 1) {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+  static_assert(info::is_reflected_v<::std::decay_t<T>>,
+                "Class must be reflected");
+  static_assert(info::is_generator_v<::std::decay_t<Generator>>,
+                "Generator is not a generator class");
+#endif
+  const auto first = ::std::begin(range);
+  const auto last = ::std::end(range);
+  if (threads == 1) {
+    aggregates<T, Generator> result;
+    for (auto it = first; it != last; ++it)
+      result.add(*it);
+    return result;
+  }
+  using Difference = typename ::std::iterator_traits<
+      ::std::decay_t<decltype(first)>>::difference_type;
+  return detail::reduce_parallel<aggregates<T, Generator>>(
+      static_cast<::std::size_t>(::std::distance(first, last)), threads,
+      [first](::std::size_t begin, ::std::size_t end) {
+        aggregates<T, Generator> result;
+        const auto stop = ::std::next(first, static_cast<Difference>(end));
+        for (auto it = ::std::next(first, static_cast<Difference>(begin));
+             it != stop; ++it)
+          result.add(*it);
+        return result;
+      });
+}
+
+/**
+ * @brief Aggregates arithmetic object variables of soa_vector, every variable
+ * is reduced over its contiguous column by vectorized loop
+ * @param soa - soa_vector
+ * @param threads - maximal amount of threads, every thread reduces at least
+ * 16384 elements (0 - hardware concurrency)
+ * @return aggregates<T, Generator>
+ */
+template <class T, class Generator = info::DefaultIndexGenerator>
+aggregates<T, Generator> aggregate(const soa_vector<T> &soa,
+                                   ::std::size_t threads = 1) {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+  static_assert(info::is_generator_v<::std::decay_t<Generator>>,
+                "Generator is not a generator class");
+#endif
+  return detail::reduce_parallel<aggregates<T, Generator>>(
+      soa.size(), threads, [&soa](::std::size_t begin, ::std::size_t end) {
+        return detail::reduce_columns<T, Generator>(
+            soa, begin, end,
+            ::std::make_index_sequence<
+                aggregates<T, Generator>::fields_count>());
+      });
+}
+} // namespace containers
+} // namespace reflect
+
+#endif // REFLECT_AGGREGATE_HPP
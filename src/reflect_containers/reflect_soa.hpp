@@ -0,0 +1,271 @@
+#ifndef REFLECT_SOA_HPP
+#define REFLECT_SOA_HPP
+
+#include "../meta_utils/meta_utils.hpp"
+#include "../reflect_information/reflect_information.hpp"
+#include "../reflect_utils/reflect_utils.hpp"
+#include <boost/hana/at.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/tuple.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace reflect {
+
+/**
+ * @brief Namespace related to containers of reflected classes
+ */
+namespace containers {
+
+namespace detail {
+
+using ObjVars = info::ObjectIndexGenerator<info::VariableIndexGenerator<
+    info::DefaultIndexGenerator>>; /**< Object variables */
+
+template <class T, long long I>
+using column_value_t = info::item_value_t<utils::selected_item_t<
+    T, ObjVars, ::boost::hana::llong<I>>>; /**< Type of object variable at
+                                              position I */
+
+/**
+ * @brief Columns of object variables
+ * @param std::index_sequence<Positions...> - positions of object variables
+ * @return boost::hana::tuple of std::vector
+ */
+template <class T, ::std::size_t... Positions>
+constexpr decltype(auto) make_columns(::std::index_sequence<Positions...> &&) {
+  return ::boost::hana::tuple<
+      ::std::vector<column_value_t<T, Positions>>...>{};
+}
+
+template <class T>
+using columns_t = ::std::decay_t<decltype(make_columns<T>(
+    ::std::make_index_sequence<utils::selected_count_v<
+        T, ObjVars>>()))>; /**< Columns of object variables of T */
+
+template <class T, class String>
+constexpr long long position_v =
+    ::std::decay_t<decltype(utils::find_by_name_first<T, ObjVars>(
+        ::std::declval<String>()))>::value; /**< Position of object variable
+                                               by name */
+} // namespace detail
+
+/**
+ * @brief Reference to element of soa_vector, element isn't stored as object,
+ * so object variables are accessed by name or position
+ */
+template <class T, class Columns> class soa_reference final {
+public:
+  /**
+   * @brief Constructor
+   * @param columns - columns of soa_vector
+   * @param index - index of element
+   */
+  soa_reference(Columns &columns, ::std::size_t index) noexcept
+      : columns_(columns), index_(index) {}
+
+  /**
+   * @brief Object variable by position
+   * @return reference to element of column
+   */
+  template <long long I> decltype(auto) get() const {
+    return ::boost::hana::at_c<I>(columns_)[index_];
+  }
+
+  /**
+   * @brief Object variable by name
+   * @param str - ct-string (boost::hana::string)
+   * @return reference to element of column
+   */
+  template <class String> decltype(auto) operator[](String &&) const {
+    return get<detail::position_v<T, String>>();
+  }
+
+  /**
+   * @brief Copies element to object
+   * @return T
+   */
+  T load() const {
+    T obj{};
+    load_impl(obj, ::std::make_index_sequence<
+                       utils::selected_count_v<T, detail::ObjVars>>());
+    return obj;
+  }
+
+  /**
+   * @brief Copies object to element
+   * @param obj - object
+   */
+  const soa_reference &operator=(const T &obj) const {
+    store_impl(obj, ::std::make_index_sequence<
+                        utils::selected_count_v<T, detail::ObjVars>>());
+    return *this;
+  }
+
+private:
+  /**
+   * @brief Copies element to object
+   * @param std::index_sequence<Positions...> - positions of object variables
+   */
+  template <::std::size_t... Positions>
+  void load_impl(T &obj, ::std::index_sequence<Positions...> &&) const {
+    ((utils::invoke<T, detail::ObjVars>(::boost::hana::llong_c<Positions>,
+                                        obj) = get<Positions>()),
+     ...);
+  }
+
+  /**
+   * @brief Copies object to element
+   * @param std::index_sequence<Positions...> - positions of object variables
+   */
+  template <::std::size_t... Positions>
+  void store_impl(const T &obj, ::std::index_sequence<Positions...> &&) const {
+    ((get<Positions>() = utils::invoke<T, detail::ObjVars>(
+          ::boost::hana::llong_c<Positions>, obj)),
+     ...);
+  }
+
+  Columns &columns_;    /**< Columns of soa_vector */
+  ::std::size_t index_; /**< Index of element */
+};
+
+/**
+ * @brief Container of reflected objects stored as struct of arrays: every
+ * object variable (including inherited ones) is stored in its own
+ * std::vector, so scan of one variable reads only its column
+ */
+template <class T> class soa_vector final {
+public:
+  using value_type = T;                      /**< Type of elements */
+  using columns_type = detail::columns_t<T>; /**< boost::hana::tuple of
+                                                columns */
+  using reference =
+      soa_reference<T, columns_type>; /**< Reference to element */
+  using const_reference =
+      soa_reference<T, const columns_type>; /**< Const reference to element */
+
+  static constexpr ::std::size_t columns_count =
+      utils::selected_count_v<T, detail::ObjVars>; /**< Amount of columns */
+
+  /**
+   * @brief Amount of elements
+   */
+  ::std::size_t size() const noexcept {
+    if constexpr (columns_count > 0)
+      return ::boost::hana::at_c<0>(columns_).size();
+    else
+      return size_;
+  }
+
+  /**
+   * @brief Checks if there are no elements
+   */
+  bool empty() const noexcept { return size() == 0; }
+
+  /**
+   * @brief Reserves memory of all columns
+   * @param capacity - amount of elements
+   */
+  void reserve(::std::size_t capacity) {
+    ::boost::hana::for_each(
+        columns_, [capacity](auto &column) { column.reserve(capacity); });
+  }
+
+  /**
+   * @brief Removes all elements
+   */
+  void clear() noexcept {
+    ::boost::hana::for_each(columns_, [](auto &column) { column.clear(); });
+    size_ = 0;
+  }
+
+  /**
+   * @brief Appends object, its variables are appended to columns
+   * @param obj - object
+   */
+  void push_back(const T &obj) {
+    push_back_impl(obj, ::std::make_index_sequence<columns_count>());
+    ++size_;
+  }
+
+  /**
+   * @brief Removes last element
+   */
+  void pop_back() {
+    ::boost::hana::for_each(columns_, [](auto &column) { column.pop_back(); });
+    --size_;
+  }
+
+  /**
+   * @brief Reference to element
+   * @param index - index of element
+   */
+  reference operator[](::std::size_t index) noexcept {
+    return reference(columns_, index);
+  }
+
+  /**
+   * @brief Const reference to element
+   * @param index - index of element
+   */
+  const_reference operator[](::std::size_t index) const noexcept {
+    return const_reference(columns_, index);
+  }
+
+  /**
+   * @brief Column by position of object variable
+   * @return std::vector of values
+   */
+  template <long long I> decltype(auto) column() noexcept {
+    return (::boost::hana::at_c<I>(columns_));
+  }
+
+  /**
+   * @brief Column by position of object variable
+   * @return const std::vector of values
+   */
+  template <long long I> decltype(auto) column() const noexcept {
+    return (::boost::hana::at_c<I>(columns_));
+  }
+
+  /**
+   * @brief Column by name of object variable
+   * @param str - ct-string (boost::hana::string)
+   * @return std::vector of values
+   */
+  template <class String> decltype(auto) column(String &&) noexcept {
+    return column<detail::position_v<T, String>>();
+  }
+
+  /**
+   * @brief Column by name of object variable
+   * @param str - ct-string (boost::hana::string)
+   * @return const std::vector of values
+   */
+  template <class String> decltype(auto) column(String &&) const noexcept {
+    return column<detail::position_v<T, String>>();
+  }
+
+private:
+  /**
+   * @brief Appends variables of object to columns
+   * @param std::index_sequence<Positions...> - positions of object variables
+   */
+  template <::std::size_t... Positions>
+  void push_back_impl(const T &obj, ::std::index_sequence<Positions...> &&) {
+    (::boost::hana::at_c<Positions>(columns_).push_back(
+         utils::invoke<T, detail::ObjVars>(::boost::hana::llong_c<Positions>,
+                                           obj)),
+     ...);
+  }
+
+  columns_type columns_;  /**< Column of every object variable */
+  ::std::size_t size_{0}; /**< Amount of elements (for classes without
+                             variables) */
+};
+} // namespace containers
+} // namespace reflect
+
+#endif // REFLECT_SOA_HPP
@@ -0,0 +1,120 @@
+#ifndef REFLECT_TRACKED_HPP
+#define REFLECT_TRACKED_HPP
+
+#include "../meta_utils/meta_utils.hpp"
+#include "../reflect_information/reflect_information.hpp"
+#include "../reflect_utils/reflect_utils.hpp"
+#include "reflect_soa.hpp"
+#include <boost/hana/integral_constant.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace reflect {
+
+namespace containers {
+
+/**
+ * @brief Reflected object which records object variables (including inherited
+ * ones) written through set. Dirty bits are stored inline in member_mask_t<T>,
+ * bit i is object variable at position i in ObjVars order, so mask can be
+ * passed to binary::serialize_delta or utils::apply_patch. Object is available
+ * only for reading, so every write is tracked
+ */
+template <class T> class tracked final {
+public:
+  using value_type = T;                          /**< Type of object */
+  using mask_type = utils::member_mask_t<T>;     /**< Type of dirty mask */
+
+  /**
+   * @brief Default constructor, no variables are dirty
+   */
+  tracked() = default;
+
+  /**
+   * @brief Constructor, no variables are dirty
+   * @param value - object
+   */
+  explicit tracked(const T &value) : value_(value) {}
+
+  /**
+   * @brief Constructor, no variables are dirty
+   * @param value - object
+   */
+  explicit tracked(T &&value) noexcept(
+      ::std::is_nothrow_move_constructible_v<T>)
+      : value_(::std::move(value)) {}
+
+  /**
+   * @brief Assigns object variable by position and marks it dirty
+   * @param value - assigned value
+   */
+  template <long long I, class V> void set(V &&value) {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+    static_assert(info::is_reflected_v<T>, "Class must be reflected");
+#endif
+    utils::set<T, detail::ObjVars>(::boost::hana::llong_c<I>,
+                                   ::std::forward<V>(value), value_);
+    dirty_.set(static_cast<::std::size_t>(I));
+  }
+
+  /**
+   * @brief Assigns object variable by name and marks it dirty
+   * @param str - ct-string (boost::hana::string)
+   * @param value - assigned value
+   */
+  template <class String, class V> void set(String &&, V &&value) {
+    set<detail::position_v<T, String>>(::std::forward<V>(value));
+  }
+
+  /**
+   * @brief Object variable by position
+   * @return const reference to variable
+   */
+  template <long long I> decltype(auto) get() const {
+    return utils::get<T, detail::ObjVars>(::boost::hana::llong_c<I>, value_);
+  }
+
+  /**
+   * @brief Object variable by name
+   * @param str - ct-string (boost::hana::string)
+   * @return const reference to variable
+   */
+  template <class String> decltype(auto) operator[](String &&) const {
+    return get<detail::position_v<T, String>>();
+  }
+
+  /**
+   * @brief Object
+   */
+  const T &value() const noexcept { return value_; }
+
+  /**
+   * @brief Access to object
+   */
+  const T *operator->() const noexcept { return &value_; }
+
+  /**
+   * @brief Mask of object variables written since construction or last
+   * clear_dirty
+   */
+  const mask_type &dirty() const noexcept { return dirty_; }
+
+  /**
+   * @brief Checks if any object variable was written
+   */
+  bool is_dirty() const noexcept { return dirty_.any(); }
+
+  /**
+   * @brief Marks all object variables clean (e.g. after they are flushed)
+   */
+  void clear_dirty() noexcept { dirty_.reset(); }
+
+private:
+  T value_{};       /**< Object */
+  mask_type dirty_; /**< Written object variables */
+};
+} // namespace containers
+} // namespace reflect
+
+#endif // REFLECT_TRACKED_HPP
@@ -0,0 +1,98 @@
+#ifndef REFL_INFORMATION_ENUM_HPP
+#define REFL_INFORMATION_ENUM_HPP
+
+#include "../../meta_utils/meta_utils.hpp"
+#include <array>
+#include <boost/preprocessor/seq/enum.hpp>
+#include <boost/preprocessor/seq/size.hpp>
+#include <boost/preprocessor/seq/transform.hpp>
+#include <boost/preprocessor/stringize.hpp>
+#include <boost/preprocessor/variadic/to_seq.hpp>
+#include <string_view>
+#include <type_traits>
+
+namespace reflect {
+
+namespace info {
+
+/**
+ * @brief Enumerators of enum E, spetialized by REFLECT_ENUM and REFLECT_FLAGS
+ */
+template <class E> struct EnumInfo;
+
+/**
+ * @brief SFINAE check if enum is reflected
+ */
+constexpr auto is_reflected_enum = ::boost::hana::is_valid(
+    [](auto &&p)
+        -> decltype(&EnumInfo<::std::decay_t<decltype(p)>>::is_flags) {});
+
+template <class E>
+constexpr bool is_reflected_enum_v = decltype(is_reflected_enum(
+    ::std::declval<E>()))::value; /**< Helper variable template for
+                                     is_reflected_enum */
+
+/**
+ * @brief Checks if enum is reflected as flag set (REFLECT_FLAGS)
+ */
+template <class E> constexpr bool is_flags_enum() {
+  if constexpr (is_reflected_enum_v<E>)
+    return EnumInfo<E>::is_flags;
+  else
+    return false;
+}
+
+template <class E>
+constexpr bool is_flags_enum_v =
+    is_flags_enum<E>(); /**< Helper variable template for is_flags_enum */
+} // namespace info
+} // namespace reflect
+
+/**
+ * @brief Enumerator NAME of TYPE
+ */
+#define REFLECT_ENUM_VALUE(_, TYPE, NAME) TYPE::NAME
+
+/**
+ * @brief Name of enumerator NAME
+ */
+#define REFLECT_ENUM_NAME(_, __, NAME) BOOST_PP_STRINGIZE(NAME)
+
+/**
+ * @brief Declarating EnumInfo spetialization for TYPE with enumerators of SEQ
+ * (boost preprocessor sequence)
+ */
+#define REFLECT_ENUM_IMPL(TYPE, FLAGS, SEQ)                                    \
+  namespace reflect {                                                          \
+  namespace info {                                                             \
+  template <> struct EnumInfo<TYPE> {                                          \
+    using Type = TYPE;                                                         \
+    static constexpr bool is_flags = FLAGS;                                    \
+    static constexpr ::std::array<Type, BOOST_PP_SEQ_SIZE(SEQ)> values{        \
+        {BOOST_PP_SEQ_ENUM(                                                    \
+            BOOST_PP_SEQ_TRANSFORM(REFLECT_ENUM_VALUE, TYPE, SEQ))}};          \
+    static constexpr ::std::array<::std::string_view, BOOST_PP_SEQ_SIZE(SEQ)>  \
+        names{{BOOST_PP_SEQ_ENUM(                                              \
+            BOOST_PP_SEQ_TRANSFORM(REFLECT_ENUM_NAME, _, SEQ))}};              \
+  };                                                                           \
+  }                                                                            \
+  }
+
+/**
+ * @brief Reflecting enumerators of enum (or enum class) TYPE. Must be used in
+ * global namespace, TYPE must be fully qualified. Enumerators are listed by
+ * name (up to 64), enumerators with equal values are allowed, first of them is
+ * used as name of value
+ */
+#define REFLECT_ENUM(TYPE, ...)                                                \
+  REFLECT_ENUM_IMPL(TYPE, false, BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__))
+
+/**
+ * @brief Reflecting enumerators of flag set TYPE (bitmask enum), value is
+ * written as names of its flags separated by '|'. Must be used in global
+ * namespace, TYPE must be fully qualified
+ */
+#define REFLECT_FLAGS(TYPE, ...)                                               \
+  REFLECT_ENUM_IMPL(TYPE, true, BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__))
+
+#endif // REFL_INFORMATION_ENUM_HPP
@@ -20,6 +20,10 @@ template <class T, class... Args> struct MethodInfo {
   static constexpr auto pointer_type(Ret (T::*)(Args...))
       -> Ret (T::*)(Args...);
 
+  template <class Ret>
+  static constexpr auto pointer_type(Ret (T::*)(Args...) noexcept)
+      -> Ret (T::*)(Args...) noexcept;
+
   template <class Ret>
   static constexpr auto return_type(Ret (T::*)(Args...)) -> Ret;
 };
@@ -33,6 +37,10 @@ template <class T, class... Args> struct ConstMethodInfo {
   static constexpr auto pointer_type(Ret (T::*)(Args...) const)
       -> Ret (T::*)(Args...) const;
 
+  template <class Ret>
+  static constexpr auto pointer_type(Ret (T::*)(Args...) const noexcept)
+      -> Ret (T::*)(Args...) const noexcept;
+
   template <class Ret>
   static constexpr auto return_type(Ret (T::*)(Args...) const) -> Ret;
 };
@@ -46,6 +54,10 @@ template <class... Args> struct MethodInfo<void, Args...> {
   template <class Ret>
   static constexpr auto pointer_type(Ret (*)(Args...)) -> Ret (*)(Args...);
 
+  template <class Ret>
+  static constexpr auto pointer_type(Ret (*)(Args...) noexcept)
+      -> Ret (*)(Args...) noexcept;
+
   template <class Ret>
   static constexpr auto return_type(Ret (*)(Args...)) -> Ret;
 };
@@ -71,33 +83,21 @@ namespace detail {}
  */
 template <class ParentGenerator, bool condition = true>
 class MethodIndexGenerator final {
-  template <class Item, long long Index>
-  constexpr static decltype(auto) check_metadata_variable() {
-    if constexpr (is_method_v<::std::decay_t<Item>> == condition)
-      return ::boost::hana::make_tuple(::boost::hana::llong_c<Index>);
-    else
-      return ::boost::hana::make_tuple();
-  }
-
-  template <class Tuple, long long... Indices>
-  constexpr static decltype(auto) generate_impl(
-      const ::boost::hana::tuple<::boost::hana::llong<Indices>...> &) {
-    return metautils::multiple_concat(
-        check_metadata_variable<decltype(::boost::hana::at_c<Indices>(
-                                    ::std::declval<Tuple>())),
-                                Indices>()...);
-  }
-
 public:
   using reverse = MethodIndexGenerator<ParentGenerator,
                                        !condition>; /**< Reverse generator */
 
+  template <class Item>
+  static constexpr bool select =
+      ParentGenerator::template select<Item> &&
+      (is_method_v<Item> == condition); /**< true if Item is selected */
+
   /**
    * @brief generate function
    * @return ::boost::hana::tuple of indices
    */
   template <class Tuple> constexpr static decltype(auto) generate() {
-    return generate_impl<Tuple>(ParentGenerator::template generate<Tuple>());
+    return detail::generate_selected<MethodIndexGenerator, Tuple>();
   }
 };
 
@@ -125,34 +125,22 @@ namespace detail {}
  */
 template <class ParentGenerator, bool condition = true>
 class ConstMethodIndexGenerator final {
-  template <class Item, long long Index>
-  constexpr static decltype(auto) check_metadata_variable() {
-    if constexpr (is_const_method_v<::std::decay_t<Item>> == condition)
-      return ::boost::hana::make_tuple(::boost::hana::llong_c<Index>);
-    else
-      return ::boost::hana::make_tuple();
-  }
-
-  template <class Tuple, long long... Indices>
-  constexpr static decltype(auto) generate_impl(
-      const ::boost::hana::tuple<::boost::hana::llong<Indices>...> &) {
-    return metautils::multiple_concat(
-        check_metadata_variable<decltype(::boost::hana::at_c<Indices>(
-                                    ::std::declval<Tuple>())),
-                                Indices>()...);
-  }
-
 public:
   using reverse =
       ConstMethodIndexGenerator<ParentGenerator,
                                 !condition>; /**< Reverse generator */
 
+  template <class Item>
+  static constexpr bool select =
+      ParentGenerator::template select<Item> &&
+      (is_const_method_v<Item> == condition); /**< true if Item is selected */
+
   /**
    * @brief generate function
    * @return ::boost::hana::tuple of indices
    */
   template <class Tuple> constexpr static decltype(auto) generate() {
-    return generate_impl<Tuple>(ParentGenerator::template generate<Tuple>());
+    return detail::generate_selected<ConstMethodIndexGenerator, Tuple>();
   }
 };
 
@@ -203,7 +191,9 @@ public:
    * @return utils::constexpr_invoke object of mem_fn_t::return_type
    */
   template <class... Args2>
-  constexpr auto operator()(Obj &&obj, Args2 &&... args)
+  constexpr auto operator()(Obj &&obj, Args2 &&... args) noexcept(
+      noexcept(metautils::constexpr_invoke(
+          p, obj, ::std::forward<Args2>(args)...)))
       -> decltype(metautils::constexpr_invoke(
           p, obj, ::std::forward<Args2>(args)...)) const {
     return metautils::constexpr_invoke(p, obj, ::std::forward<Args2>(args)...);
@@ -217,7 +207,9 @@ public:
    * @return utils::constexpr_invoke object of mem_fn_t::return_type
    */
   template <class... Args2>
-  constexpr auto operator()(const Obj &obj, Args2 &&... args)
+  constexpr auto operator()(const Obj &obj, Args2 &&... args) noexcept(
+      noexcept(metautils::constexpr_invoke(
+          p, obj, ::std::forward<Args2>(args)...)))
       -> decltype(metautils::constexpr_invoke(
           p, obj, ::std::forward<Args2>(args)...)) const {
     return metautils::constexpr_invoke(p, obj, ::std::forward<Args2>(args)...);
@@ -231,7 +223,9 @@ public:
    * @return utils::constexpr_invoke object of mem_fn_t::return_type
    */
   template <class... Args2>
-  constexpr auto operator()(Obj &obj, Args2 &&... args)
+  constexpr auto operator()(Obj &obj, Args2 &&... args) noexcept(
+      noexcept(metautils::constexpr_invoke(
+          p, obj, ::std::forward<Args2>(args)...)))
       -> decltype(metautils::constexpr_invoke(
           p, obj, ::std::forward<Args2>(args)...)) const {
     return metautils::constexpr_invoke(p, obj, ::std::forward<Args2>(args)...);
@@ -293,7 +287,9 @@ public:
    * @return utils::constexpr_invoke object of mem_fn_t::return_type
    */
   template <class... Args2>
-  constexpr auto operator()(const Obj &obj, Args2 &&... args)
+  constexpr auto operator()(const Obj &obj, Args2 &&... args) noexcept(
+      noexcept(metautils::constexpr_invoke(
+          p, obj, ::std::forward<Args2>(args)...)))
       -> decltype(metautils::constexpr_invoke(
           p, obj, ::std::forward<Args2>(args)...)) const {
     return metautils::constexpr_invoke(p, obj, ::std::forward<Args2>(args)...);
@@ -347,8 +343,10 @@ public:
    * @return utils::constexpr_invoke object of static_fn_t::return_type
    */
   template <class... Args2>
-  constexpr auto operator()(Args2 &&... args) -> decltype(
-      metautils::constexpr_invoke(p, ::std::forward<Args2>(args)...)) const {
+  constexpr auto operator()(Args2 &&... args) noexcept(
+      noexcept(metautils::constexpr_invoke(p, ::std::forward<Args2>(args)...)))
+      -> decltype(metautils::constexpr_invoke(
+          p, ::std::forward<Args2>(args)...)) const {
     return metautils::constexpr_invoke(p, ::std::forward<Args2>(args)...);
   }
 
@@ -359,12 +357,223 @@ public:
    * @return utils::constexpr_invoke object of static_fn_t::return_type
    */
   template <class T, class... Args2>
-  constexpr auto operator()(T &&, Args2 &&... args) -> decltype(
-      metautils::constexpr_invoke(p, ::std::forward<Args2>(args)...)) const {
+  constexpr auto operator()(T &&, Args2 &&... args) noexcept(
+      noexcept(metautils::constexpr_invoke(p, ::std::forward<Args2>(args)...)))
+      -> decltype(metautils::constexpr_invoke(
+          p, ::std::forward<Args2>(args)...)) const {
     return metautils::constexpr_invoke(p, ::std::forward<Args2>(args)...);
   }
 };
 
+/**
+ * @brief Pointer to object method as template parameter. Class is empty, so
+ * invocation doesn't read pointer from metadata and is a direct call
+ */
+template <auto P, class... Args> class obj_method_c;
+
+/**
+ * @brief Pointer to object method as template parameter (template
+ * spetialization for pointer to object method)
+ */
+template <class Result, class Obj, Result Obj::*P, class... Args>
+class obj_method_c<P, Args...> {
+public:
+  using obj_type = Obj; /**< Object type of pointer to object method */
+
+  using type = Result Obj::*; /**< Method type */
+
+  using arg_types = ::std::decay_t<decltype(
+      ::boost::hana::tuple_t<Obj, Args...>)>; /**< Method arguments type */
+
+  using return_type = decltype(metautils::constexpr_invoke(
+      std::declval<type>(), std::declval<obj_type>(),
+      std::declval<Args>()...)); /**< Method return type */
+
+  /**
+   * @brief method that indicates that the pointer - method
+   *
+   * @return std::true_type
+   */
+  static constexpr auto is_method() { return std::true_type(); }
+
+  /**
+   * @brief method that indicates that the pointer - pointer to object method
+   *
+   * @return std::true_type
+   */
+  static constexpr auto is_object() { return std::true_type(); }
+
+  /**
+   * @brief Invoke method
+   *
+   * @param obj member object
+   * @param args function arguments
+   * @return utils::constexpr_invoke object of obj_method_c::return_type
+   */
+  template <class... Args2>
+  constexpr auto operator()(Obj &&obj, Args2 &&... args) const noexcept(
+      noexcept(metautils::constexpr_invoke(
+          P, obj, ::std::forward<Args2>(args)...)))
+      -> decltype(metautils::constexpr_invoke(
+          P, obj, ::std::forward<Args2>(args)...)) {
+    return metautils::constexpr_invoke(P, obj, ::std::forward<Args2>(args)...);
+  }
+
+  /**
+   * @brief Invoke method
+   *
+   * @param obj member object
+   * @param args function arguments
+   * @return utils::constexpr_invoke object of obj_method_c::return_type
+   */
+  template <class... Args2>
+  constexpr auto operator()(const Obj &obj, Args2 &&... args) const noexcept(
+      noexcept(metautils::constexpr_invoke(
+          P, obj, ::std::forward<Args2>(args)...)))
+      -> decltype(metautils::constexpr_invoke(
+          P, obj, ::std::forward<Args2>(args)...)) {
+    return metautils::constexpr_invoke(P, obj, ::std::forward<Args2>(args)...);
+  }
+
+  /**
+   * @brief Invoke method
+   *
+   * @param obj member object
+   * @param args function arguments
+   * @return utils::constexpr_invoke object of obj_method_c::return_type
+   */
+  template <class... Args2>
+  constexpr auto operator()(Obj &obj, Args2 &&... args) const noexcept(
+      noexcept(metautils::constexpr_invoke(
+          P, obj, ::std::forward<Args2>(args)...)))
+      -> decltype(metautils::constexpr_invoke(
+          P, obj, ::std::forward<Args2>(args)...)) {
+    return metautils::constexpr_invoke(P, obj, ::std::forward<Args2>(args)...);
+  }
+};
+
+/**
+ * @brief Pointer to const object method as template parameter. Class is
+ * empty, so invocation is a direct call
+ */
+template <auto P, class... Args> class obj_const_method_c;
+
+/**
+ * @brief Pointer to const object method as template parameter (template
+ * spetialization for pointer to object method)
+ */
+template <class Result, class Obj, Result Obj::*P, class... Args>
+class obj_const_method_c<P, Args...> {
+public:
+  using obj_type = Obj; /**< Object type of pointer to const object method */
+
+  using type = Result Obj::*; /**< Method type */
+
+  using arg_types = ::std::decay_t<decltype(
+      ::boost::hana::tuple_t<Obj, Args...>)>; /**< Method arguments type */
+
+  using return_type = decltype(metautils::constexpr_invoke(
+      std::declval<type>(), std::declval<obj_type>(),
+      std::declval<Args>()...)); /**< Method return type */
+
+  /**
+   * @brief method that indicates that the pointer - const method
+   *
+   * @return std::true_type
+   */
+  static constexpr auto is_const_method() { return std::true_type(); }
+
+  /**
+   * @brief method that indicates that the pointer - method
+   *
+   * @return std::true_type
+   */
+  static constexpr auto is_method() { return std::true_type(); }
+
+  /**
+   * @brief method that indicates that the pointer - pointer to object method
+   *
+   * @return std::true_type
+   */
+  static constexpr auto is_object() { return std::true_type(); }
+
+  /**
+   * @brief Invoke method
+   *
+   * @param obj member object
+   * @param args function arguments
+   * @return utils::constexpr_invoke object of obj_const_method_c::return_type
+   */
+  template <class... Args2>
+  constexpr auto operator()(const Obj &obj, Args2 &&... args) const noexcept(
+      noexcept(metautils::constexpr_invoke(
+          P, obj, ::std::forward<Args2>(args)...)))
+      -> decltype(metautils::constexpr_invoke(
+          P, obj, ::std::forward<Args2>(args)...)) {
+    return metautils::constexpr_invoke(P, obj, ::std::forward<Args2>(args)...);
+  }
+};
+
+/**
+ * @brief Pointer to static method as template parameter. Class is empty, so
+ * invocation is a direct call
+ */
+template <class Obj_class, auto P, class... Args> class static_method_c {
+public:
+  using obj_type = Obj_class; /**< Object type of pointer to object method */
+
+  using type = decltype(P); /**< Method type */
+
+  using arg_types = ::std::decay_t<decltype(
+      ::boost::hana::tuple_t<Args...>)>; /**< Method arguments type */
+
+  using return_type = decltype(metautils::constexpr_invoke(
+      std::declval<type>(),
+      std::declval<Args>()...)); /**< Method return type */
+
+  /**
+   * @brief method that indicates that the pointer - method
+   *
+   * @return std::true_type
+   */
+  static constexpr auto is_method() { return std::true_type(); }
+
+  /**
+   * @brief method that indicates that the method - static
+   *
+   * @return std::true_type
+   */
+  static constexpr auto is_static() { return std::true_type(); }
+
+  /**
+   * @brief Invoke method (if class object is not provided)
+   *
+   * @param args function arguments
+   * @return utils::constexpr_invoke object of static_method_c::return_type
+   */
+  template <class... Args2>
+  constexpr auto operator()(Args2 &&... args) const noexcept(
+      noexcept(metautils::constexpr_invoke(P, ::std::forward<Args2>(args)...)))
+      -> decltype(metautils::constexpr_invoke(
+          P, ::std::forward<Args2>(args)...)) {
+    return metautils::constexpr_invoke(P, ::std::forward<Args2>(args)...);
+  }
+
+  /**
+   * @brief Invoke method (if class object is provided)
+   *
+   * @param args function arguments
+   * @return utils::constexpr_invoke object of static_method_c::return_type
+   */
+  template <class T, class... Args2>
+  constexpr auto operator()(T &&, Args2 &&... args) const noexcept(
+      noexcept(metautils::constexpr_invoke(P, ::std::forward<Args2>(args)...)))
+      -> decltype(metautils::constexpr_invoke(
+          P, ::std::forward<Args2>(args)...)) {
+    return metautils::constexpr_invoke(P, ::std::forward<Args2>(args)...);
+  }
+};
+
 /**
  * @brief Create mem_fn_t
  *
@@ -397,21 +606,128 @@ template <class T, class R, class... Args>
 constexpr decltype(auto) make_method(R *pm) {
   return static_method_t<T, R, Args...>(pm);
 }
+
+/**
+ * @brief Create obj_method_c
+ *
+ * @return obj_method_c<P, Args...>
+ */
+template <auto P, class... Args> constexpr decltype(auto) make_method() {
+  return obj_method_c<P, Args...>();
+}
+
+/**
+ * @brief Create obj_const_method_c
+ *
+ * @return obj_const_method_c<P, Args...>
+ */
+template <auto P, class... Args> constexpr decltype(auto) make_const_method() {
+  return obj_const_method_c<P, Args...>();
+}
+
+/**
+ * @brief Create static_method_c
+ *
+ * @return static_method_c<T, P, Args...>
+ */
+template <class T, auto P, class... Args>
+constexpr decltype(auto) make_method() {
+  return static_method_c<T, P, Args...>();
+}
 } // namespace info
 } // namespace reflect
 
+/**
+ * @brief Function type of object method NAME with arguments (noexcept is
+ * preserved)
+ */
+#define REFLECT_OBJ_MTD_TYPE(NAME, ...)                                        \
+  ::reflect::metautils::member_pointer_type_t<                                 \
+      decltype(::reflect::info::detail::MethodInfo<                            \
+               Type, ##__VA_ARGS__>::pointer_type(&Type::NAME))>
+
+/**
+ * @brief Function type of constant object method NAME with arguments
+ * (noexcept is preserved)
+ */
+#define REFLECT_CONST_OBJ_MTD_TYPE(NAME, ...)                                  \
+  ::reflect::metautils::member_pointer_type_t<                                 \
+      decltype(::reflect::info::detail::ConstMethodInfo<                       \
+               Type, ##__VA_ARGS__>::pointer_type(&Type::NAME))>
+
+/**
+ * @brief Function type of static method NAME with arguments (noexcept is
+ * preserved)
+ */
+#define REFLECT_STATIC_MTD_TYPE(NAME, ...)                                     \
+  ::std::remove_pointer_t<                                                     \
+      decltype(::reflect::info::detail::MethodInfo<                            \
+               void, ##__VA_ARGS__>::pointer_type(&Type::NAME))>
+
+#ifdef COUSOUS_STATELESS_METADATA
+/**
+ * @brief Metadata of object method (pointer is template parameter)
+ */
+#define REFLECT_MAKE_OBJ_MTD(NAME, ...)                                        \
+  ::reflect::info::make_method<                                                \
+      static_cast<decltype(::reflect::info::detail::MethodInfo<                \
+                           Type, ##__VA_ARGS__>::pointer_type(&Type::NAME))>(  \
+          &Type::NAME),                                                        \
+      ##__VA_ARGS__>()
+
+/**
+ * @brief Metadata of constant object method (pointer is template parameter)
+ */
+#define REFLECT_MAKE_CONST_OBJ_MTD(NAME, ...)                                  \
+  ::reflect::info::make_const_method<                                          \
+      static_cast<decltype(::reflect::info::detail::ConstMethodInfo<           \
+                           Type, ##__VA_ARGS__>::pointer_type(&Type::NAME))>(  \
+          &Type::NAME),                                                        \
+      ##__VA_ARGS__>()
+
+/**
+ * @brief Metadata of static method (pointer is template parameter)
+ */
+#define REFLECT_MAKE_STATIC_MTD(NAME, ...)                                     \
+  ::reflect::info::make_method<                                                \
+      Type,                                                                    \
+      static_cast<decltype(::reflect::info::detail::MethodInfo<                \
+                           void, ##__VA_ARGS__>::pointer_type(&Type::NAME))>(  \
+          &Type::NAME),                                                        \
+      ##__VA_ARGS__>()
+#else
+/**
+ * @brief Metadata of object method (pointer is data member)
+ */
+#define REFLECT_MAKE_OBJ_MTD(NAME, ...)                                        \
+  ::reflect::info::make_method<REFLECT_OBJ_MTD_TYPE(NAME, ##__VA_ARGS__),      \
+                               Type, ##__VA_ARGS__>(&Type::NAME)
+
+/**
+ * @brief Metadata of constant object method (pointer is data member)
+ */
+#define REFLECT_MAKE_CONST_OBJ_MTD(NAME, ...)                                  \
+  ::reflect::info::make_const_method<                                          \
+      REFLECT_CONST_OBJ_MTD_TYPE(NAME, ##__VA_ARGS__), Type, ##__VA_ARGS__>(   \
+      &Type::NAME)
+
+/**
+ * @brief Metadata of static method (pointer is data member)
+ */
+#define REFLECT_MAKE_STATIC_MTD(NAME, ...)                                     \
+  ::reflect::info::make_method<                                                \
+      Type, REFLECT_STATIC_MTD_TYPE(NAME, ##__VA_ARGS__), ##__VA_ARGS__>(      \
+      &Type::NAME)
+#endif
+
 /**
  * @brief Reflect object method. Appends name to names_state, method pointer to
  * metadata_state and increase counter
  */
 #define REFLECT_OBJ_MTD(NAME, ...)                                             \
   TUPLE_APPEND(names_state, counter, HANA_STR(#NAME))                          \
-  TUPLE_APPEND(                                                                \
-      metadata_state, counter,                                                 \
-      ::reflect::info::make_method<                                            \
-          decltype(::reflect::info::detail::MethodInfo<Type, ##__VA_ARGS__>::  \
-                       return_type(&Type::NAME))(__VA_ARGS__),                 \
-          Type, ##__VA_ARGS__>(&Type::NAME))                                   \
+  TUPLE_APPEND(metadata_state, counter,                                        \
+               REFLECT_MAKE_OBJ_MTD(NAME, ##__VA_ARGS__))                      \
   INCREASE_COUNTER(counter)
 
 /**
@@ -421,11 +737,7 @@ constexpr decltype(auto) make_method(R *pm) {
 #define REFLECT_CONST_OBJ_MTD(NAME, ...)                                       \
   TUPLE_APPEND(names_state, counter, HANA_STR(#NAME))                          \
   TUPLE_APPEND(metadata_state, counter,                                        \
-               ::reflect::info::make_const_method<                             \
-                   decltype(::reflect::info::detail::ConstMethodInfo<          \
-                            Type, ##__VA_ARGS__>::return_type(&Type::NAME))(   \
-                       __VA_ARGS__) const,                                     \
-                   Type, ##__VA_ARGS__>(&Type::NAME))                          \
+               REFLECT_MAKE_CONST_OBJ_MTD(NAME, ##__VA_ARGS__))                \
   INCREASE_COUNTER(counter)
 
 /**
@@ -434,13 +746,8 @@ constexpr decltype(auto) make_method(R *pm) {
  */
 #define REFLECT_STATIC_MTD(NAME, ...)                                          \
   TUPLE_APPEND(names_state, counter, HANA_STR(#NAME))                          \
-  TUPLE_APPEND(                                                                \
-      metadata_state, counter,                                                 \
-      ::reflect::info::make_method<                                            \
-          Type,                                                                \
-          decltype(::reflect::info::detail::MethodInfo<void, ##__VA_ARGS__>::  \
-                       return_type(&Type::NAME))(__VA_ARGS__),                 \
-          ##__VA_ARGS__>(&Type::NAME))                                         \
+  TUPLE_APPEND(metadata_state, counter,                                        \
+               REFLECT_MAKE_STATIC_MTD(NAME, ##__VA_ARGS__))                   \
   INCREASE_COUNTER(counter)
 
 #endif // REFLECT_INFORMATION_METHOD_HPP
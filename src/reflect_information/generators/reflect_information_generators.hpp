@@ -0,0 +1,139 @@
+#ifndef REFL_INFORMATION_GENERATORS_HPP
+#define REFL_INFORMATION_GENERATORS_HPP
+
+#include "../../meta_utils/meta_utils.hpp"
+#include <type_traits>
+
+namespace reflect {
+
+namespace info {
+
+namespace detail {
+
+/**
+ * @brief Generate indices of items selected by Generator implementation
+ *
+ * @param std::integer_sequence<long long,Indices...> indices of all items
+ * @return ::boost::hana::tuple of indices
+ */
+template <class Generator, class Tuple, long long... Indices>
+constexpr decltype(auto)
+generate_selected_impl(::std::integer_sequence<long long, Indices...> &&) {
+  return metautils::filter_indices(
+      ::std::integer_sequence<
+          bool, Generator::template select<
+                    metautils::tuple_item_t<Indices, Tuple>>...>(),
+      ::boost::hana::tuple<::boost::hana::llong<Indices>...>{});
+}
+
+/**
+ * @brief Generate indices of items selected by Generator. All predicates of
+ * Generator (including its parent generators) are evaluated in one pass over
+ * tuple
+ *
+ * @return ::boost::hana::tuple of indices
+ */
+template <class Generator, class Tuple>
+constexpr decltype(auto) generate_selected() {
+  return generate_selected_impl<Generator, Tuple>(
+      ::std::make_integer_sequence<long long, decltype(::boost::hana::size(
+                                                  ::std::declval<Tuple>()))::
+                                                  value>());
+}
+} // namespace detail
+
+template <class... Generators> class And;
+template <class... Generators> class Or;
+template <class Generator> class Not;
+
+/**
+ * @brief The And class - selects items that are selected by all Generators
+ */
+template <class... Generators> class And final {
+public:
+  using reverse = Or<Not<Generators>...>; /**< Reverse generator */
+
+  template <class Item>
+  static constexpr bool select =
+      (true && ... &&
+       Generators::template select<Item>); /**< true if Item is selected */
+
+  /**
+   * @brief generate function
+   * @return ::boost::hana::tuple of indices
+   */
+  template <class Tuple> constexpr static decltype(auto) generate() {
+    return detail::generate_selected<And, Tuple>();
+  }
+};
+
+/**
+ * @brief The Or class - selects items that are selected by any of Generators
+ */
+template <class... Generators> class Or final {
+public:
+  using reverse = And<Not<Generators>...>; /**< Reverse generator */
+
+  template <class Item>
+  static constexpr bool select =
+      (false || ... ||
+       Generators::template select<Item>); /**< true if Item is selected */
+
+  /**
+   * @brief generate function
+   * @return ::boost::hana::tuple of indices
+   */
+  template <class Tuple> constexpr static decltype(auto) generate() {
+    return detail::generate_selected<Or, Tuple>();
+  }
+};
+
+/**
+ * @brief The Not class - selects items that aren't selected by Generator
+ */
+template <class Generator> class Not final {
+public:
+  using reverse = Generator; /**< Reverse generator */
+
+  template <class Item>
+  static constexpr bool select =
+      !Generator::template select<Item>; /**< true if Item is selected */
+
+  /**
+   * @brief generate function
+   * @return ::boost::hana::tuple of indices
+   */
+  template <class Tuple> constexpr static decltype(auto) generate() {
+    return detail::generate_selected<Not, Tuple>();
+  }
+};
+
+template <class Item>
+using item_value_t = ::std::remove_cv_t<::std::remove_reference_t<
+    typename Item::return_type>>; /**< Type of variable or result type of
+                                     method */
+
+/**
+ * @brief The ByType class - selects items which type (type of variable or
+ * result type of method) satisfies Pred, e.g. ByType<std::is_arithmetic>
+ */
+template <template <class> class Pred> class ByType final {
+public:
+  using reverse = Not<ByType>; /**< Reverse generator */
+
+  template <class Item>
+  static constexpr bool select =
+      Pred<item_value_t<Item>>::value; /**< true if Item is selected */
+
+  /**
+   * @brief generate function
+   * @return ::boost::hana::tuple of indices
+   */
+  template <class Tuple> constexpr static decltype(auto) generate() {
+    return detail::generate_selected<ByType, Tuple>();
+  }
+};
+} // namespace info
+} // namespace reflect
+
+#endif // REFL_INFORMATION_GENERATORS_HPP
@@ -2,8 +2,11 @@
 #define REFL_INFORMATION_HPP
 
 #include "../meta_utils/meta_utils.hpp"
+#include "enums/reflect_information_enum.hpp"
 #include "functions/reflect_information_method.hpp"
 #include "variables/reflect_information_variable.hpp"
+#include <cstddef>
+#include <type_traits>
 
 namespace reflect {
 
@@ -41,6 +44,18 @@ constexpr bool is_reflected_v =
 
 namespace detail {
 
+/**
+ * @brief Current value of compile-time counter of MetaInfo_type
+ */
+template <class MetaInfo_type> constexpr ::std::size_t counter_value() {
+  constexpr auto high =
+      decltype(counter(metautils::detail::counter_digit<>{},
+                       static_cast<const MetaInfo_type *>(nullptr)))::value;
+  return decltype(counter(metautils::counter<high>{},
+                          metautils::detail::counter_digit<>{},
+                          static_cast<const MetaInfo_type *>(nullptr)))::value;
+}
+
 template <class MetaInfo_type> constexpr decltype(auto) names_tuple();
 
 template <class MetaInfo_type> constexpr decltype(auto) metadata_tuple();
@@ -126,10 +141,8 @@ metadata_tuple_impl(::std::integer_sequence<long long, Indices...> &&) {
  */
 template <class MetaInfo_type> constexpr decltype(auto) names_tuple() {
   return names_tuple_impl<MetaInfo_type>(
-      ::std::make_integer_sequence<
-          long long, decltype(counter(metautils::counter<>{},
-                                      static_cast<const MetaInfo_type *>(
-                                          nullptr)))::value>{});
+      ::std::make_integer_sequence<long long,
+                                   counter_value<MetaInfo_type>()>{});
 }
 
 /**
@@ -137,10 +150,8 @@ template <class MetaInfo_type> constexpr decltype(auto) names_tuple() {
  */
 template <class MetaInfo_type> constexpr decltype(auto) metadata_tuple() {
   return metadata_tuple_impl<MetaInfo_type>(
-      ::std::make_integer_sequence<
-          long long, decltype(counter(metautils::counter<>{},
-                                      static_cast<const MetaInfo_type *>(
-                                          nullptr)))::value>{});
+      ::std::make_integer_sequence<long long,
+                                   counter_value<MetaInfo_type>()>{});
 }
 } // namespace detail
 
@@ -157,6 +168,8 @@ template <class T> struct MetaClass {
       detail::names_tuple<T>()}; /**< tuple of all variable names */
   static constexpr auto metadata{
       detail::metadata_tuple<T>()}; /**< tuple of all method names*/
+  static constexpr auto name_hashes{metautils::ct_string_hashes(
+      names)}; /**< hashes of all names (std::array) */
 };
 
 class EmptyGenerator;
@@ -169,6 +182,9 @@ class DefaultIndexGenerator final {
 public:
   using reverse = EmptyGenerator;
 
+  template <class Item>
+  static constexpr bool select = true; /**< Every item is selected */
+
   /**
    * @brief Generate tuple of indices
    * @return  ::boost::hana::tuple<0...N-1>
@@ -186,6 +202,9 @@ class EmptyGenerator final {
 public:
   using reverse = DefaultIndexGenerator;
 
+  template <class Item>
+  static constexpr bool select = false; /**< No item is selected */
+
   template <class Tuple>
   /**
    * @brief Generate empty tuple
@@ -218,8 +237,7 @@ template <class... Args> struct MetaInfo;
       ->decltype(#TYPE) {                                                      \
     return #TYPE;                                                              \
   }                                                                            \
-  friend constexpr ::reflect::metautils::counter<0> counter(                   \
-      ::reflect::metautils::counter<0>, const MetaInfo_type *);
+  INIT_COUNTER(counter)
 
 /**
  * @brief Declarating metainformation outside of class. All staff related to
@@ -248,8 +266,7 @@ template <class... Args> struct MetaInfo;
         -> decltype(#TYPE) {                                                   \
       return #TYPE;                                                            \
     }                                                                          \
-    friend constexpr ::reflect::metautils::counter<0>                          \
-        counter(::reflect::metautils::counter<0>, const MetaInfo_type *);
+    INIT_COUNTER(counter)
 
 /**
  * @brief Declarating MetaInfo spetialization for template class TYPE<TEMPLATE>.
@@ -269,8 +286,7 @@ template <class... Args> struct MetaInfo;
         -> decltype(#TYPE) {                                                   \
       return #TYPE;                                                            \
     }                                                                          \
-    friend constexpr ::reflect::metautils::counter<0>                          \
-        counter(::reflect::metautils::counter<0>, const MetaInfo_type *);
+    INIT_COUNTER(counter)
 
 /**
  * @brief Needed only to end metainformation outside class (OUT_METAINFO)
@@ -281,6 +297,50 @@ template <class... Args> struct MetaInfo;
   }                                                                            \
   }
 
+/**
+ * @brief High digit of COUNTER current value
+ */
+#define COUNTER_HIGH(COUNTER)                                                  \
+  decltype(COUNTER(::reflect::metautils::detail::counter_digit<>{},            \
+                   static_cast<const MetaInfo_type *>(nullptr)))::value
+
+/**
+ * @brief COUNTER current value. High digit is found first, after that low
+ * digit is found only among values with same high digit
+ */
+#define COUNTER_VALUE(COUNTER)                                                 \
+  decltype(COUNTER(::reflect::metautils::counter<COUNTER_HIGH(COUNTER)>{},     \
+                   ::reflect::metautils::detail::counter_digit<>{},            \
+                   static_cast<const MetaInfo_type *>(nullptr)))::value
+
+/**
+ * @brief Declaring COUNTER function that marks high digit of VALUE. All values
+ * with same high digit redeclare same function
+ */
+#define DECLARE_COUNTER_HIGH(COUNTER, VALUE)                                   \
+  friend constexpr auto COUNTER(                                               \
+      ::reflect::metautils::detail::counter_high_t<VALUE> digit,               \
+      const MetaInfo_type *)                                                   \
+      ->decltype(digit);
+
+/**
+ * @brief Declaring COUNTER function that holds VALUE
+ */
+#define DECLARE_COUNTER_LOW(COUNTER, VALUE)                                    \
+  friend constexpr auto COUNTER(                                               \
+      ::reflect::metautils::counter<(VALUE) / COUNTER_BASE> high,              \
+      ::reflect::metautils::detail::counter_low_t<VALUE> low,                  \
+      const MetaInfo_type *)                                                   \
+      ->::reflect::metautils::detail::counter_value_t<decltype(high),          \
+                                                      decltype(low)>;
+
+/**
+ * @brief Declaring COUNTER with zero value
+ */
+#define INIT_COUNTER(COUNTER)                                                  \
+  DECLARE_COUNTER_HIGH(COUNTER, 0)                                             \
+  DECLARE_COUNTER_LOW(COUNTER, 0)
+
 /**
  * @brief Appending element to STATE. Element index will be same as current
  * COUNTER. Creates function that will return boost::hana::tuple of element for
@@ -288,28 +348,38 @@ template <class... Args> struct MetaInfo;
  */
 #define TUPLE_APPEND(STATE, COUNTER, ...)                                      \
   friend constexpr auto STATE(                                                 \
-      ::reflect::metautils::counter<decltype(                                  \
-          COUNTER(::reflect::metautils::counter<>{},                           \
-                  static_cast<const MetaInfo_type *>(nullptr)))::value>,       \
-      const Type *, const MetaInfo_type *)                                     \
+      ::reflect::metautils::counter<COUNTER_VALUE(COUNTER)>, const Type *,     \
+      const MetaInfo_type *)                                                   \
       ->decltype(::boost::hana::make_tuple(__VA_ARGS__)) {                     \
     return ::boost::hana::make_tuple(__VA_ARGS__);                             \
   }
 
 /**
- * @brief Increasing COUNTER by one. Create COUNTER function that will hold
- * current counter value + 1
+ * @brief Declaring offset_state function that returns offsetof(Type, NAME) for
+ * current COUNTER value, or -1 if Type is not standard-layout. Generic lambda
+ * keeps offsetof in discarded branch for non-standard-layout types
+ */
+#define DECLARE_OFFSET(COUNTER, NAME)                                          \
+  friend constexpr ::std::ptrdiff_t offset_state(                              \
+      ::reflect::metautils::counter<COUNTER_VALUE(COUNTER)>, const Type *,     \
+      const MetaInfo_type *) {                                                 \
+    return [](auto *object) -> ::std::ptrdiff_t {                              \
+      using Object = ::std::remove_pointer_t<decltype(object)>;                \
+      if constexpr (::std::is_standard_layout_v<Object>)                       \
+        return offsetof(Object, NAME);                                         \
+      else                                                                     \
+        return -1;                                                             \
+    }(static_cast<Type *>(nullptr));                                           \
+  }
+
+/**
+ * @brief Increasing COUNTER by one. Firstly it marks high digit of new value,
+ * after that creates COUNTER function that will hold current counter value + 1
+ * (if high digit was just increased, current value is taken from
+ * metautils::detail::counter fallback)
  */
 #define INCREASE_COUNTER(COUNTER)                                              \
-  friend constexpr ::reflect::metautils::counter<                              \
-      decltype(COUNTER(::reflect::metautils::counter<>{},                      \
-                       static_cast<const MetaInfo_type *>(nullptr)))::value +  \
-      1u>                                                                      \
-  COUNTER(::reflect::metautils::counter<                                       \
-              decltype(COUNTER(                                                \
-                  ::reflect::metautils::counter<>{},                           \
-                  static_cast<const MetaInfo_type *>(nullptr)))::value +       \
-              1u>,                                                             \
-          const MetaInfo_type *);
+  DECLARE_COUNTER_HIGH(COUNTER, COUNTER_VALUE(COUNTER) + 1)                    \
+  DECLARE_COUNTER_LOW(COUNTER, COUNTER_VALUE(COUNTER) + 1)
 
 #endif // META_INFORMATION_HPP
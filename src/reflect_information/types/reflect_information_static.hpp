@@ -2,6 +2,7 @@
 #define REFL_INFORMATION_STATIC_COMMON_HPP
 
 #include "../../meta_utils/meta_utils.hpp"
+#include "../generators/reflect_information_generators.hpp"
 
 namespace reflect {
 
@@ -24,33 +25,21 @@ constexpr bool is_static_v = decltype(is_static(
  */
 template <class ParentGenerator, bool condition = true>
 class StaticIndexGenerator final {
-  template <class Item, long long Index>
-  constexpr static decltype(auto) check_metadata_variable() {
-    if constexpr (is_static_v<::std::decay_t<Item>> == condition)
-      return ::boost::hana::make_tuple(::boost::hana::llong_c<Index>);
-    else
-      return ::boost::hana::make_tuple();
-  }
-
-  template <class Tuple, long long... Indices>
-  constexpr static decltype(auto) generate_impl(
-      const ::boost::hana::tuple<::boost::hana::llong<Indices>...> &) {
-    return metautils::multiple_concat(
-        check_metadata_variable<decltype(::boost::hana::at_c<Indices>(
-                                    ::std::declval<Tuple>())),
-                                Indices>()...);
-  }
-
 public:
   using reverse = StaticIndexGenerator<ParentGenerator,
                                        !condition>; /**< Reverse generator */
 
+  template <class Item>
+  static constexpr bool select =
+      ParentGenerator::template select<Item> &&
+      (is_static_v<Item> == condition); /**< true if Item is selected */
+
   /**
    * @brief generate function
    * @return ::boost::hana::tuple of indices
    */
   template <class Tuple> constexpr static decltype(auto) generate() {
-    return generate_impl<Tuple>(ParentGenerator::template generate<Tuple>());
+    return detail::generate_selected<StaticIndexGenerator, Tuple>();
   }
 };
 } // namespace info
@@ -2,6 +2,7 @@
 #define REFL_INFORMATION_VARIABLE_HPP
 
 #include "../../meta_utils/meta_utils.hpp"
+#include "../generators/reflect_information_generators.hpp"
 #include "../types/reflect_information_object.hpp"
 #include "../types/reflect_information_static.hpp"
 
@@ -29,33 +30,21 @@ namespace detail {}
  */
 template <class ParentGenerator, bool condition = true>
 class VariableIndexGenerator final {
-  template <class Item, long long Index>
-  constexpr static decltype(auto) check_metadata_variable() {
-    if constexpr (is_variable_v<::std::decay_t<Item>> == condition)
-      return ::boost::hana::make_tuple(::boost::hana::llong_c<Index>);
-    else
-      return ::boost::hana::make_tuple();
-  }
-
-  template <class Tuple, long long... Indices>
-  constexpr static decltype(auto) generate_impl(
-      const ::boost::hana::tuple<::boost::hana::llong<Indices>...> &) {
-    return metautils::multiple_concat(
-        check_metadata_variable<decltype(::boost::hana::at_c<Indices>(
-                                    ::std::declval<Tuple>())),
-                                Indices>()...);
-  }
-
 public:
   using reverse = VariableIndexGenerator<ParentGenerator,
                                          !condition>; /**< Reverse generator */
 
+  template <class Item>
+  static constexpr bool select =
+      ParentGenerator::template select<Item> &&
+      (is_variable_v<Item> == condition); /**< true if Item is selected */
+
   /**
    * @brief generate function
    * @return ::boost::hana::tuple of indices
    */
   template <class Tuple> constexpr static decltype(auto) generate() {
-    return generate_impl<Tuple>(ParentGenerator::template generate<Tuple>());
+    return detail::generate_selected<VariableIndexGenerator, Tuple>();
   }
 };
 
@@ -105,7 +94,8 @@ public:
    * @param obj member object
    * @return utils::constexpr_invoke object of obj_var_t::return_type
    */
-  constexpr auto operator()(obj_type &&obj)
+  constexpr auto operator()(obj_type &&obj) noexcept(
+      noexcept(metautils::constexpr_invoke(p, obj)))
       -> decltype(metautils::constexpr_invoke(p, obj)) const {
     return metautils::constexpr_invoke(p, obj);
   }
@@ -116,7 +106,8 @@ public:
    * @param obj member object
    * @return utils::constexpr_invoke object of obj_var_t::return_type
    */
-  constexpr auto operator()(const obj_type &obj)
+  constexpr auto operator()(const obj_type &obj) noexcept(
+      noexcept(metautils::constexpr_invoke(p, obj)))
       -> decltype(metautils::constexpr_invoke(p, obj)) const {
     return metautils::constexpr_invoke(p, obj);
   }
@@ -127,7 +118,8 @@ public:
    * @param obj member object
    * @return utils::constexpr_invoke object of obj_var_t::return_type
    */
-  constexpr auto operator()(obj_type &obj)
+  constexpr auto operator()(obj_type &obj) noexcept(
+      noexcept(metautils::constexpr_invoke(p, obj)))
       -> decltype(metautils::constexpr_invoke(p, obj)) const {
     return metautils::constexpr_invoke(p, obj);
   }
@@ -177,18 +169,143 @@ public:
    *
    * @return object of static_var_t::return_type
    */
-  constexpr auto operator()() -> decltype(*p) const { return *p; }
+  constexpr auto operator()() noexcept -> decltype(*p) const { return *p; }
 
   /**
    * @brief Dereference of pointer (if class object is provided)
    *
    * @return object of static_var_t::return_type
    */
-  template <class T> constexpr auto operator()(T &&) -> decltype(*p) const {
+  template <class T>
+  constexpr auto operator()(T &&) noexcept -> decltype(*p) const {
     return *p;
   }
 };
 
+/**
+ * @brief Pointer to object variable as template parameter. Class is empty, so
+ * invocation doesn't read pointer from metadata and is a direct access. Class
+ * (and other *_c classes) isn't final, so tuple of metadata is empty too
+ */
+template <auto P> class obj_var_c;
+
+/**
+ * @brief Pointer to object variable as template parameter (template
+ * spetialization for pointer to object variable)
+ */
+template <class Result, class Obj, Result Obj::*P> class obj_var_c<P> {
+public:
+  using obj_type = Obj; /**< Object type of pointer */
+
+  using type = Result Obj::*; /**< Pointer type */
+
+  using arg_types = ::std::decay_t<decltype(
+      ::boost::hana::tuple_t<Obj>)>; /**< Tuple pointer type (Needed to unify
+                                        all pointer structs) */
+
+  using return_type = decltype(metautils::constexpr_invoke(
+      std::declval<type>(), std::declval<obj_type>())); /**< Return type */
+
+  /**
+   * @brief method that indicates that the pointer - variable
+   *
+   * @return std::true_type
+   */
+  static constexpr auto is_variable() { return std::true_type(); }
+
+  /**
+   * @brief method that indicates that the pointer - pointer to object variable
+   *
+   * @return std::true_type
+   */
+  static constexpr auto is_object() { return std::true_type(); }
+
+  /**
+   * @brief Invoke operator
+   *
+   * @param obj member object
+   * @return utils::constexpr_invoke object of obj_var_c::return_type
+   */
+  constexpr auto operator()(obj_type &&obj) const noexcept(
+      noexcept(metautils::constexpr_invoke(P, obj)))
+      -> decltype(metautils::constexpr_invoke(P, obj)) {
+    return metautils::constexpr_invoke(P, obj);
+  }
+
+  /**
+   * @brief Invoke operator
+   *
+   * @param obj member object
+   * @return utils::constexpr_invoke object of obj_var_c::return_type
+   */
+  constexpr auto operator()(const obj_type &obj) const noexcept(
+      noexcept(metautils::constexpr_invoke(P, obj)))
+      -> decltype(metautils::constexpr_invoke(P, obj)) {
+    return metautils::constexpr_invoke(P, obj);
+  }
+
+  /**
+   * @brief Invoke operator
+   *
+   * @param obj member object
+   * @return utils::constexpr_invoke object of obj_var_c::return_type
+   */
+  constexpr auto operator()(obj_type &obj) const noexcept(
+      noexcept(metautils::constexpr_invoke(P, obj)))
+      -> decltype(metautils::constexpr_invoke(P, obj)) {
+    return metautils::constexpr_invoke(P, obj);
+  }
+};
+
+/**
+ * @brief Pointer to a static variable as template parameter. Class is empty,
+ * so invocation is a direct access
+ */
+template <class Obj_class, auto P> class static_var_c {
+public:
+  using obj_type = Obj_class; /**< Object type of pointer to object variable */
+
+  using type = decltype(P); /**< Pointer type */
+
+  using arg_types = ::std::decay_t<decltype(
+      ::boost::hana::tuple_t<>)>; /**< Tuple pointer type (Needed to
+        unify all pointer structs) */
+
+  using return_type = std::add_rvalue_reference_t<
+      std::remove_reference_t<decltype(*P)>>; /**< Object of pointer type */
+
+  /**
+   * @brief method that indicates that the pointer - variable
+   *
+   * @return std::true_type
+   */
+  static constexpr auto is_variable() { return std::true_type(); }
+
+  /**
+   * @brief method that indicates that the pointer - static
+   *
+   * @return std::true_type
+   */
+  static constexpr auto is_static() { return std::true_type(); }
+
+  /**
+   * @brief Dereference of pointer (if class object is not provided)
+   *
+   * @return object of static_var_c::return_type
+   */
+  constexpr auto operator()() const noexcept -> decltype(*P) { return *P; }
+
+  /**
+   * @brief Dereference of pointer (if class object is provided)
+   *
+   * @return object of static_var_c::return_type
+   */
+  template <class T>
+  constexpr auto operator()(T &&) const noexcept -> decltype(*P) {
+    return *P;
+  }
+};
+
 /**
  * @brief Create obj_var_t
  *
@@ -208,17 +325,58 @@ template <class R, class T> constexpr decltype(auto) make_var(R T::*pm) {
 template <class R, class T> constexpr decltype(auto) make_var(T *pm) {
   return static_var_t<R, T>(pm);
 }
+
+/**
+ * @brief Create obj_var_c
+ *
+ * @return obj_var_c<P>
+ */
+template <auto P> constexpr decltype(auto) make_var() { return obj_var_c<P>(); }
+
+/**
+ * @brief Create static_var_c
+ *
+ * @return static_var_c<T, P>
+ */
+template <class T, auto P> constexpr decltype(auto) make_var() {
+  return static_var_c<T, P>();
+}
 } // namespace info
 } // namespace reflect
 
+#ifdef COUSOUS_STATELESS_METADATA
+/**
+ * @brief Metadata of object variable (pointer is template parameter)
+ */
+#define REFLECT_MAKE_OBJ_VAR(NAME) ::reflect::info::make_var<&Type::NAME>()
+
+/**
+ * @brief Metadata of static variable (pointer is template parameter)
+ */
+#define REFLECT_MAKE_STATIC_VAR(NAME)                                          \
+  ::reflect::info::make_var<Type, &Type::NAME>()
+#else
+/**
+ * @brief Metadata of object variable (pointer is data member)
+ */
+#define REFLECT_MAKE_OBJ_VAR(NAME) ::reflect::info::make_var(&Type::NAME)
+
+/**
+ * @brief Metadata of static variable (pointer is data member)
+ */
+#define REFLECT_MAKE_STATIC_VAR(NAME)                                          \
+  ::reflect::info::make_var<Type>(&Type::NAME)
+#endif
+
 /**
  * @brief Reflect object variable. Appends to names_state name of var, to
- * metadata_state pointer to variable and increase counter
+ * metadata_state pointer to variable, declares its offset_state and increase
+ * counter
  */
 #define REFLECT_OBJ_VAR(NAME)                                                  \
   TUPLE_APPEND(names_state, counter, HANA_STR(#NAME))                          \
-  TUPLE_APPEND(metadata_state, counter,                                        \
-               ::reflect::info::make_var(&Type::NAME))                         \
+  TUPLE_APPEND(metadata_state, counter, REFLECT_MAKE_OBJ_VAR(NAME))            \
+  DECLARE_OFFSET(counter, NAME)                                                \
   INCREASE_COUNTER(counter)
 
 /**
@@ -227,8 +385,7 @@ template <class R, class T> constexpr decltype(auto) make_var(T *pm) {
  */
 #define REFLECT_STATIC_VAR(NAME)                                               \
   TUPLE_APPEND(names_state, counter, HANA_STR(#NAME))                          \
-  TUPLE_APPEND(metadata_state, counter,                                        \
-               ::reflect::info::make_var<Type>(&Type::NAME))                   \
+  TUPLE_APPEND(metadata_state, counter, REFLECT_MAKE_STATIC_VAR(NAME))         \
   INCREASE_COUNTER(counter)
 
 #endif // REFLECT_INFORMATION_VARIABLE_HPP
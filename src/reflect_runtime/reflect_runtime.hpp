@@ -0,0 +1,668 @@
+#ifndef REFLECT_RUNTIME_HPP
+#define REFLECT_RUNTIME_HPP
+
+#include "../meta_utils/meta_utils.hpp"
+#include "../reflect_information/reflect_information.hpp"
+#include "../reflect_utils/reflect_utils.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace reflect {
+
+/**
+ * @brief Namespace related to runtime reflection (access to members by names
+ * known only at runtime)
+ */
+namespace runtime {
+
+using type_id = const void *; /**< Unique identifier of type */
+
+namespace detail {
+
+/**
+ * @brief Holder of unique address for every type
+ */
+template <class T> struct type_id_tag {
+  static constexpr char id = 0; /**< Object which address identifies T */
+};
+} // namespace detail
+
+template <class T>
+constexpr type_id type_id_v = &detail::type_id_tag<::std::remove_cv_t<
+    ::std::remove_reference_t<T>>>::id; /**< Identifier of type T (cv and
+                                           reference are ignored) */
+
+/**
+ * @brief Runtime descriptor of reflected element (variable or method)
+ */
+struct MemberInfo {
+  /**
+   * @brief Kind flags of element
+   */
+  enum Flags : ::std::uint32_t {
+    Variable = 1u << 0, /**< Element is variable */
+    Method = 1u << 1,   /**< Element is method */
+    Object = 1u << 2,   /**< Element is object variable/method */
+    Static = 1u << 3,   /**< Element is static variable/method */
+    Const = 1u << 4     /**< Element is const method or const variable */
+  };
+
+  using getter = void (*)(const void *object,
+                          void *value); /**< Copies value of variable from
+                                           object to value */
+  using setter = void (*)(void *object,
+                          const void *value); /**< Assigns value to variable
+                                                 of object */
+
+  static constexpr ::std::ptrdiff_t no_offset = -1; /**< Offset isn't known */
+  static constexpr ::std::uint32_t npos =
+      static_cast<::std::uint32_t>(-1); /**< No next element */
+
+  ::std::string_view name; /**< Name of element */
+  type_id type;            /**< Type of variable or result type of method */
+  getter get;              /**< Getter of variable (nullptr if variable can't
+                              be copied or element is method) */
+  setter set;              /**< Setter of variable (nullptr if variable can't
+                              be assigned or element is method) */
+  ::std::ptrdiff_t offset; /**< Offset of object variable in standard layout
+                              class or no_offset */
+  ::std::uint32_t flags;   /**< Kind flags of element */
+  ::std::uint32_t next; /**< Index of next element with the same name (next
+                           overload) or npos */
+
+  /**
+   * @brief Checks kind of element
+   * @param flag - kind flag
+   * @return true if element has flag
+   */
+  constexpr bool is(Flags flag) const { return (flags & flag) != 0; }
+};
+
+/**
+ * @brief Runtime type-erased descriptor of reflected class. Elements are
+ * stored in flat array in the order of MetaClass<T>::metadata, name lookup uses
+ * perfect hash computed at compile time
+ */
+class MetaObject final {
+public:
+  static constexpr ::std::size_t npos =
+      static_cast<::std::size_t>(-1); /**< Element is not found */
+
+  using index_function = ::std::size_t (*)(
+      ::std::string_view); /**< Finds index of element by name */
+
+  /**
+   * @brief Constructor
+   * @param name - class name
+   * @param type - class type identifier
+   * @param members - descriptors of elements
+   * @param size - amount of elements
+   * @param index_of - function which finds index of element by name
+   */
+  constexpr MetaObject(::std::string_view name, type_id type,
+                       const MemberInfo *members, ::std::size_t size,
+                       index_function index_of) noexcept
+      : name_(name), type_(type), members_(members), size_(size),
+        index_of_(index_of) {}
+
+  /**
+   * @brief Class name
+   */
+  constexpr ::std::string_view name() const noexcept { return name_; }
+
+  /**
+   * @brief Class type identifier
+   */
+  constexpr type_id type() const noexcept { return type_; }
+
+  /**
+   * @brief Amount of elements
+   */
+  constexpr ::std::size_t size() const noexcept { return size_; }
+
+  /**
+   * @brief Descriptor of element
+   * @param index - index of element
+   */
+  constexpr const MemberInfo &operator[](::std::size_t index) const noexcept {
+    return members_[index];
+  }
+
+  /**
+   * @brief Pointer to first descriptor
+   */
+  constexpr const MemberInfo *begin() const noexcept { return members_; }
+
+  /**
+   * @brief Pointer after last descriptor
+   */
+  constexpr const MemberInfo *end() const noexcept {
+    return members_ + size_;
+  }
+
+  /**
+   * @brief Finds index of first element with given name
+   * @param name - name of element
+   * @return index of element or npos
+   */
+  ::std::size_t index_of(::std::string_view name) const {
+    return index_of_(name);
+  }
+
+  /**
+   * @brief Finds first element with given name
+   * @param name - name of element
+   * @return descriptor of element or nullptr
+   */
+  const MemberInfo *find(::std::string_view name) const {
+    ::std::size_t index = index_of_(name);
+    return index != npos ? members_ + index : nullptr;
+  }
+
+  /**
+   * @brief Copies value of variable
+   * @param object - object of described class
+   * @param name - name of variable
+   * @param value - value of variable, type must be equal to type of variable
+   * @return true if value is copied
+   */
+  template <class T, class Value>
+  bool get(const T &object, ::std::string_view name, Value &value) const {
+    const MemberInfo *member = find(name);
+    if (type_id_v<T> != type_ || !member || !member->get ||
+        member->type != type_id_v<Value>)
+      return false;
+    member->get(&object, &value);
+    return true;
+  }
+
+  /**
+   * @brief Assigns value to variable
+   * @param object - object of described class
+   * @param name - name of variable
+   * @param value - value of variable, type must be equal to type of variable
+   * @return true if value is assigned
+   */
+  template <class T, class Value>
+  bool set(T &object, ::std::string_view name, const Value &value) const {
+    const MemberInfo *member = find(name);
+    if (type_id_v<T> != type_ || !member || !member->set ||
+        member->type != type_id_v<Value>)
+      return false;
+    member->set(&object, &value);
+    return true;
+  }
+
+private:
+  ::std::string_view name_;  /**< Class name */
+  type_id type_;             /**< Class type identifier */
+  const MemberInfo *members_; /**< Descriptors of elements */
+  ::std::size_t size_;       /**< Amount of elements */
+  index_function index_of_;  /**< Finds index of element by name */
+};
+
+/**
+ * @brief Error of invocation by name
+ */
+enum class InvokeError {
+  None,              /**< Element is invoked */
+  NotFound,          /**< There is no element with such name */
+  NoMatchingOverload /**< No element with such name can be invoked with given
+                        arguments (or its result can't be converted) */
+};
+
+/**
+ * @brief Result of invocation by name: error code and converted result of
+ * element
+ */
+template <class Result = void> class InvokeResult final {
+public:
+  /**
+   * @brief Constructor of failed invocation
+   * @param error - error code
+   */
+  InvokeResult(InvokeError error) noexcept : error_(error) {}
+
+  /**
+   * @brief Constructor of successful invocation
+   * @param value - result of element
+   */
+  template <class Value>
+  InvokeResult(::std::in_place_t, Value &&value)
+      : error_(InvokeError::None), value_(::std::forward<Value>(value)) {}
+
+  /**
+   * @brief Error code
+   */
+  InvokeError error() const noexcept { return error_; }
+
+  /**
+   * @brief Checks if element is invoked
+   */
+  explicit operator bool() const noexcept {
+    return error_ == InvokeError::None;
+  }
+
+  /**
+   * @brief Result of element, element must be invoked
+   */
+  Result &value() { return *value_; }
+
+  /**
+   * @brief Result of element, element must be invoked
+   */
+  const Result &value() const { return *value_; }
+
+private:
+  InvokeError error_;              /**< Error code */
+  ::std::optional<Result> value_; /**< Result of element */
+};
+
+/**
+ * @brief Result of invocation by name (template spetialization for void)
+ */
+template <> class InvokeResult<void> final {
+public:
+  /**
+   * @brief Constructor
+   * @param error - error code
+   */
+  InvokeResult(InvokeError error) noexcept : error_(error) {}
+
+  /**
+   * @brief Error code
+   */
+  InvokeError error() const noexcept { return error_; }
+
+  /**
+   * @brief Checks if element is invoked
+   */
+  explicit operator bool() const noexcept {
+    return error_ == InvokeError::None;
+  }
+
+private:
+  InvokeError error_; /**< Error code */
+};
+
+template <class T> const MetaObject &meta_object();
+
+namespace detail {
+
+/**
+ * @brief Index of next element with the same hash for every element
+ * @param hashes - hash of every element
+ * @return std::array of indices (MemberInfo::npos if there is no such element)
+ */
+template <::std::size_t N>
+constexpr decltype(auto)
+next_same_hash(const ::std::array<unsigned long long, N> &hashes) {
+  ::std::array<::std::uint32_t, N> result{};
+  for (::std::size_t i = 0; i < N; ++i) {
+    result[i] = MemberInfo::npos;
+    for (::std::size_t j = i + 1; j < N && result[i] == MemberInfo::npos; ++j)
+      if (hashes[j] == hashes[i])
+        result[i] = static_cast<::std::uint32_t>(j);
+  }
+  return result;
+}
+
+/**
+ * @brief Compile-time data of MetaObject of T
+ */
+template <class T> struct meta_object_data {
+  static constexpr ::std::size_t size = decltype(::boost::hana::size(
+      utils::MetaClass<T>::metadata))::value; /**< Amount of elements */
+  static constexpr auto names{metautils::ct_string_views(
+      utils::MetaClass<T>::names)}; /**< Names of elements */
+  static constexpr metautils::perfect_hash<size> hash{
+      utils::MetaClass<T>::name_hashes}; /**< Perfect hash of names */
+  static constexpr auto next{next_same_hash(
+      utils::MetaClass<T>::name_hashes)}; /**< Next element with the same name
+                                           */
+};
+
+/**
+ * @brief Finds index of element by name
+ * @param name - name of element
+ * @return index of element or MetaObject::npos
+ */
+template <class T> ::std::size_t index_of(::std::string_view name) {
+  using Data = meta_object_data<T>;
+  ::std::uint32_t index = Data::hash.find(metautils::string_hash(name));
+  return index != Data::hash.npos && Data::names[index] == name
+             ? index
+             : MetaObject::npos;
+}
+
+template <class T, long long I>
+using member_item_t = metautils::tuple_item_t<
+    I, decltype(utils::MetaClass<T>::metadata)>; /**< Metadata type of element
+                                                    I */
+
+template <class T, long long I>
+using member_value_t =
+    info::item_value_t<member_item_t<T, I>>; /**< Type of variable or result
+                                                type of method I */
+
+template <class T, long long I>
+using member_ref_t = decltype(utils::invoke<T, info::DefaultIndexGenerator>(
+    ::boost::hana::llong_c<I>,
+    ::std::declval<T &>())); /**< Result of variable I access */
+
+/**
+ * @brief Copies value of variable I from object to value
+ */
+template <class T, long long I>
+void get_member(const void *object, void *value) {
+  *static_cast<member_value_t<T, I> *>(value) =
+      utils::invoke<T, info::DefaultIndexGenerator>(
+          ::boost::hana::llong_c<I>, *static_cast<const T *>(object));
+}
+
+/**
+ * @brief Assigns value to variable I of object
+ */
+template <class T, long long I>
+void set_member(void *object, const void *value) {
+  utils::invoke<T, info::DefaultIndexGenerator>(::boost::hana::llong_c<I>,
+                                                *static_cast<T *>(object)) =
+      *static_cast<const member_value_t<T, I> *>(value);
+}
+
+template <class T, long long I> ::std::ptrdiff_t member_offset();
+
+/**
+ * @brief Offset of inherited object variable I of parents starting from parent
+ * P. Base subobjects of standard layout class share its address, so offset in
+ * parent is offset in T
+ */
+template <class T, long long I, ::std::size_t P = 0>
+::std::ptrdiff_t parent_member_offset() {
+  using Parent = typename ::std::decay_t<decltype(
+      ::boost::hana::at_c<P>(::std::declval<utils::Parents<T>>()))>::type;
+  constexpr long long size = decltype(
+      ::boost::hana::size(utils::MetaClass<Parent>::metadata))::value;
+  if constexpr (I < size)
+    return member_offset<Parent, I>();
+  else
+    return parent_member_offset<T, I - size, P + 1>();
+}
+
+/**
+ * @brief Offset of object variable I in standard layout class. Own variables
+ * take offsetof from offset_state declared by REFLECT_OBJ_VAR
+ * @return offset or MemberInfo::no_offset
+ */
+template <class T, long long I> ::std::ptrdiff_t member_offset() {
+  using MetaInfo_type = typename T::MetaInfo_type;
+  constexpr long long own = info::detail::counter_value<MetaInfo_type>();
+  if constexpr (!::std::is_standard_layout_v<T> ||
+                !info::is_object_v<member_item_t<T, I>>)
+    return MemberInfo::no_offset;
+  else if constexpr (I < own)
+    return offset_state(metautils::counter<I>{},
+                        static_cast<const T *>(nullptr),
+                        static_cast<const MetaInfo_type *>(nullptr));
+  else
+    return parent_member_offset<T, I - own>();
+}
+
+/**
+ * @brief Kind flags of element
+ */
+template <class Item> constexpr ::std::uint32_t member_flags() {
+  ::std::uint32_t flags =
+      info::is_variable_v<Item> ? MemberInfo::Variable : MemberInfo::Method;
+  if constexpr (info::is_object_v<Item>)
+    flags |= MemberInfo::Object;
+  if constexpr (info::is_static_v<Item>)
+    flags |= MemberInfo::Static;
+  if constexpr (info::is_const_method_v<Item>)
+    flags |= MemberInfo::Const;
+  if constexpr (info::is_variable_v<Item> &&
+                ::std::is_const_v<::std::remove_reference_t<
+                    typename Item::return_type>>)
+    flags |= MemberInfo::Const;
+  return flags;
+}
+
+/**
+ * @brief Descriptor of element I
+ */
+template <class T, long long I> MemberInfo member_info() {
+  using Item = member_item_t<T, I>;
+  using Value = member_value_t<T, I>;
+  MemberInfo member{meta_object_data<T>::names[I],
+                    type_id_v<Value>,
+                    nullptr,
+                    nullptr,
+                    MemberInfo::no_offset,
+                    member_flags<Item>(),
+                    meta_object_data<T>::next[I]};
+  if constexpr (info::is_variable_v<Item>) {
+    if constexpr (::std::is_copy_assignable_v<Value>)
+      member.get = &get_member<T, I>;
+    if constexpr (::std::is_assignable_v<member_ref_t<T, I>, const Value &>)
+      member.set = &set_member<T, I>;
+    member.offset = member_offset<T, I>();
+  }
+  return member;
+}
+
+/**
+ * @brief Checks if decayed parameter types of element are equal to decayed
+ * Args
+ * @param std::index_sequence<Positions...> - positions of parameters
+ */
+template <class Item, class... Args, ::std::size_t... Positions>
+constexpr bool is_exact_overload_impl(::std::index_sequence<Positions...> &&) {
+  constexpr ::std::size_t offset = info::is_object_v<Item> ? 1 : 0;
+  using Params = typename Item::arg_types;
+  constexpr ::std::size_t size =
+      decltype(::boost::hana::size(::std::declval<Params>()))::value;
+  if constexpr (size != offset + sizeof...(Args))
+    return false;
+  else
+    return (true && ... &&
+            ::std::is_same_v<
+                ::std::decay_t<typename metautils::tuple_item_t<
+                    Positions + offset, Params>::type>,
+                ::std::decay_t<Args>>);
+}
+
+/**
+ * @brief Checks if element can be invoked with obj and args and its result
+ * can be converted to Result
+ */
+template <class Result, class Item, class... Args>
+constexpr bool is_viable_overload_impl() {
+  if constexpr (!utils::detail::is_invocable_v<Item, Args...>)
+    return false;
+  else if constexpr (::std::is_void_v<Result>)
+    return true;
+  else
+    return ::std::is_convertible_v<decltype(::std::declval<Item>()(
+                                       ::std::declval<Args>()...)),
+                                   Result>;
+}
+
+/**
+ * @brief Checks if element I can be invoked with obj and args (object is not
+ * passed to static elements) and its result can be converted to Result
+ */
+template <class T, class Result, class Obj, long long I, class... Args>
+constexpr bool is_viable_overload() {
+  using Item = member_item_t<T, I>;
+  if constexpr (info::is_static_v<Item>)
+    return is_viable_overload_impl<Result, Item, Args...>();
+  else
+    return is_viable_overload_impl<Result, Item, Obj, Args...>();
+}
+
+/**
+ * @brief Chooses overload for every element: first element with the same name
+ * which parameter types are equal to arguments types, otherwise first viable
+ * element with the same name
+ * @param next - next element with the same name
+ * @param viable - element can be invoked with arguments
+ * @param exact - parameter types of element are equal to arguments types
+ * @return std::array of element indices (MemberInfo::npos if there is no
+ * viable element)
+ */
+template <::std::size_t N>
+constexpr decltype(auto)
+choose_overloads(const ::std::array<::std::uint32_t, N> &next,
+                 const ::std::array<bool, N> &viable,
+                 const ::std::array<bool, N> &exact) {
+  ::std::array<::std::uint32_t, N> result{};
+  for (::std::size_t i = 0; i < N; ++i) {
+    ::std::uint32_t first_viable = MemberInfo::npos;
+    ::std::uint32_t first_exact = MemberInfo::npos;
+    for (::std::uint32_t j = static_cast<::std::uint32_t>(i);
+         j != MemberInfo::npos && first_exact == MemberInfo::npos;
+         j = next[j]) {
+      if (viable[j] && exact[j])
+        first_exact = j;
+      if (viable[j] && first_viable == MemberInfo::npos)
+        first_viable = j;
+    }
+    result[i] = first_exact != MemberInfo::npos ? first_exact : first_viable;
+  }
+  return result;
+}
+
+/**
+ * @brief Invokes element I (MemberInfo::npos if there is no viable element)
+ * @param obj - object (isn't passed to static elements)
+ * @param args - arguments of invocation
+ * @return InvokeResult
+ */
+template <class T, class Result, class Obj, ::std::uint32_t I, class... Args>
+InvokeResult<Result> invoke_overload([[maybe_unused]] Obj &&obj,
+                                     [[maybe_unused]] Args &&... args) {
+  if constexpr (I == MemberInfo::npos)
+    return InvokeError::NoMatchingOverload;
+  else {
+    auto item = ::boost::hana::at_c<I>(utils::MetaClass<T>::metadata);
+    auto invoke = [&]() -> decltype(auto) {
+      if constexpr (info::is_static_v<member_item_t<T, I>>)
+        return item(::std::forward<Args>(args)...);
+      else
+        return item(::std::forward<Obj>(obj), ::std::forward<Args>(args)...);
+    };
+    if constexpr (::std::is_void_v<Result>) {
+      invoke();
+      return InvokeError::None;
+    } else
+      return InvokeResult<Result>(::std::in_place, invoke());
+  }
+}
+
+/**
+ * @brief Table of invocation thunks, one per element. Thunk of element invokes
+ * overload chosen for given argument types at compile time
+ */
+template <class T, class Result, class Obj, class Indices, class... Args>
+struct invoke_by_name_table;
+
+/**
+ * @brief Table of invocation thunks (template spetialization for
+ * std::integer_sequence)
+ */
+template <class T, class Result, class Obj, long long... Indices,
+          class... Args>
+struct invoke_by_name_table<
+    T, Result, Obj, ::std::integer_sequence<long long, Indices...>, Args...> {
+  using thunk_type = InvokeResult<Result> (*)(Obj &&,
+                                              Args &&...); /**< Thunk type */
+
+  static constexpr ::std::array<::std::uint32_t, sizeof...(Indices)>
+      overloads = choose_overloads(
+          meta_object_data<T>::next,
+          ::std::array<bool, sizeof...(Indices)>{
+              {is_viable_overload<T, Result, Obj, Indices, Args...>()...}},
+          ::std::array<bool, sizeof...(Indices)>{
+              {is_exact_overload_impl<member_item_t<T, Indices>, Args...>(
+                  ::std::index_sequence_for<Args...>())...}}); /**< Chosen
+                                                                  overloads */
+
+  static constexpr thunk_type value[] = {
+      &invoke_overload<T, Result, Obj, overloads[Indices], Args...>...}; /**<
+                                                                 Thunks */
+};
+
+/**
+ * @brief Descriptors of all elements
+ * @param std::integer_sequence<long long, Indices...> - indices of elements
+ * @return std::array of descriptors
+ */
+template <class T, long long... Indices>
+decltype(auto) members_info(::std::integer_sequence<long long, Indices...> &&) {
+  return ::std::array<MemberInfo, sizeof...(Indices)>{
+      {member_info<T, Indices>()...}};
+}
+} // namespace detail
+
+/**
+ * @brief Runtime descriptor of reflected class T. Descriptor is built once, on
+ * first call, without dynamic allocation
+ * @return MetaObject
+ */
+template <class T> const MetaObject &meta_object() {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+  static_assert(decltype(utils::check_reflected<T>())::value,
+                "Class must be reflected");
+#endif
+  using Type = ::std::decay_t<T>;
+  static const auto members{detail::members_info<Type>(
+      ::std::make_integer_sequence<long long,
+                                   detail::meta_object_data<Type>::size>())};
+  static const MetaObject object{
+      ::std::string_view(utils::MetaClass<Type>::class_name.c_str()),
+      type_id_v<Type>, members.data(), members.size(),
+      &detail::index_of<Type>};
+  return object;
+}
+
+/**
+ * @brief Invokes element (method or variable) by name known at runtime. Name
+ * is found by perfect hash, overload is chosen at compile time by types of
+ * arguments: element which parameter types are equal to decayed types of
+ * arguments, otherwise first element which can be invoked with arguments
+ * @param obj - object (isn't passed to static elements)
+ * @param name - name of element
+ * @param args - arguments of invocation
+ * @return InvokeResult<Result> with result of element converted to Result or
+ * error code
+ */
+template <class T, class Result = void, class Obj, class... Args>
+InvokeResult<Result> invoke_by_name(Obj &&obj, ::std::string_view name,
+                                    Args &&... args) {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+  static_assert(decltype(utils::check_reflected<T>())::value,
+                "Class must be reflected");
+#endif
+  using Type = ::std::decay_t<T>;
+  constexpr ::std::size_t size = detail::meta_object_data<Type>::size;
+  if constexpr (size == 0)
+    return InvokeError::NotFound;
+  else {
+    ::std::size_t index = detail::index_of<Type>(name);
+    if (index == MetaObject::npos)
+      return InvokeError::NotFound;
+    return detail::invoke_by_name_table<
+        Type, Result, Obj, ::std::make_integer_sequence<long long, size>,
+        Args...>::value[index](::std::forward<Obj>(obj),
+                               ::std::forward<Args>(args)...);
+  }
+}
+} // namespace runtime
+} // namespace reflect
+
+#endif // REFLECT_RUNTIME_HPP
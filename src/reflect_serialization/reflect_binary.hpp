@@ -0,0 +1,561 @@
+#ifndef REFLECT_BINARY_HPP
+#define REFLECT_BINARY_HPP
+
+#include "../meta_utils/meta_utils.hpp"
+#include "../reflect_information/reflect_information.hpp"
+#include "../reflect_utils/reflect_utils.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace reflect {
+
+/**
+ * @brief Namespace related to binary serialization of reflected classes.
+ * Object variables are written in reflection order (variables of parents
+ * first), trivially copyable values are written as bytes in native byte order,
+ * std::string, std::vector and views are prefixed by length (size_type), enums
+ * (including reflected ones) are written by value.
+ * Deserialized views (std::string_view, std::span<const std::byte>) point into
+ * input, std::pmr containers can be filled from given memory resource (arena)
+ */
+namespace binary {
+
+using size_type = ::std::uint64_t; /**< Type of length prefix */
+
+constexpr size_type max_empty_elements =
+    size_type{1} << 20; /**< Maximum length of std::vector of elements which
+                           take no bytes (reflected classes without object
+                           variables), their count isn't bounded by input */
+
+/**
+ * @brief Appends bytes to std::string
+ */
+class Writer final {
+public:
+  /**
+   * @brief Constructor
+   * @param buffer - buffer to append bytes
+   */
+  explicit Writer(::std::string &buffer) noexcept : buffer_(buffer) {}
+
+  /**
+   * @brief Appends bytes
+   * @param data - pointer to bytes
+   * @param size - amount of bytes
+   */
+  void write(const void *data, ::std::size_t size) {
+    buffer_.append(static_cast<const char *>(data), size);
+  }
+
+private:
+  ::std::string &buffer_; /**< Output buffer */
+};
+
+/**
+ * @brief Reads bytes from buffer with bounds checks
+ */
+class Reader final {
+public:
+  /**
+   * @brief Constructor
+   * @param data - input bytes
+   * @param resource - memory resource of std::pmr containers (nullptr -
+   * containers keep their allocators)
+   */
+  explicit Reader(::std::string_view data,
+                  ::std::pmr::memory_resource *resource = nullptr) noexcept
+      : data_(data), resource_(resource) {}
+
+  /**
+   * @brief Reads bytes
+   * @param data - pointer to output
+   * @param size - amount of bytes
+   * @return false if there are not enough bytes
+   */
+  bool read(void *data, ::std::size_t size) {
+    if (size > data_.size())
+      return false;
+    if (size > 0)
+      ::std::memcpy(data, data_.data(), size);
+    data_.remove_prefix(size);
+    return true;
+  }
+
+  /**
+   * @brief Borrows bytes without copying them
+   * @param data - output pointer to bytes inside of input
+   * @param size - amount of bytes
+   * @return false if there are not enough bytes
+   */
+  bool borrow(const char *&data, ::std::size_t size) {
+    if (size > data_.size())
+      return false;
+    data = data_.data();
+    data_.remove_prefix(size);
+    return true;
+  }
+
+  /**
+   * @brief Amount of unread bytes
+   */
+  ::std::size_t remaining() const noexcept { return data_.size(); }
+
+  /**
+   * @brief Memory resource of std::pmr containers
+   */
+  ::std::pmr::memory_resource *resource() const noexcept { return resource_; }
+
+private:
+  ::std::string_view data_;               /**< Unread bytes */
+  ::std::pmr::memory_resource *resource_; /**< Memory resource */
+};
+
+namespace detail {
+
+using ObjVars = info::ObjectIndexGenerator<info::VariableIndexGenerator<
+    info::DefaultIndexGenerator>>; /**< Object variables */
+
+template <class T>
+constexpr bool is_bytes_v =
+    ::std::is_trivially_copyable_v<T> && !::std::is_pointer_v<T> &&
+    !::std::is_member_pointer_v<T> && !metautils::is_view_v<T> &&
+    !info::is_reflected_v<T>; /**< T is written as bytes */
+
+template <class T, long long I>
+using field_t = info::item_value_t<metautils::tuple_item_t<
+    I, decltype(utils::MetaClass<T>::metadata)>>; /**< Type of variable I */
+
+/**
+ * @brief Amount of elements of parents
+ * @param std::index_sequence<Positions...> - positions of parents
+ */
+template <class Parents, ::std::size_t... Positions>
+constexpr ::std::size_t
+inherited_count_impl(::std::index_sequence<Positions...> &&) {
+  return (::std::size_t{0} + ... +
+          decltype(::boost::hana::size(
+              utils::MetaClass<typename metautils::tuple_item_t<
+                  Positions, Parents>::type>::metadata))::value);
+}
+
+/**
+ * @brief Indices of own (not inherited) object variables, inherited elements
+ * are placed after own ones
+ * @param boost::hana::tuple<boost::hana::llong<Indices>...> - indices of all
+ * object variables
+ * @return std::array of indices
+ */
+template <::std::size_t Own, long long... Indices>
+constexpr decltype(auto)
+own_fields(const ::boost::hana::tuple<::boost::hana::llong<Indices>...> &) {
+  constexpr long long indices[] = {Indices..., 0};
+  ::std::array<long long, (::std::size_t{0} + ... +
+                           ::std::size_t{Indices < static_cast<long long>(
+                                                       Own)})>
+      result{};
+  for (::std::size_t i = 0; i < result.size(); ++i)
+    result[i] = indices[i];
+  return result;
+}
+
+/**
+ * @brief Compile-time layout of serialized class T: own object variables and
+ * runs of adjacent variables written as bytes
+ */
+template <class T> struct layout {
+  using Parents = utils::Parents<T>; /**< Direct parents */
+
+  static constexpr ::std::size_t parents_count = decltype(
+      ::boost::hana::size(::std::declval<Parents>()))::value; /**< Amount of
+                                                                 parents */
+
+  static constexpr ::std::size_t own_count =
+      decltype(::boost::hana::size(utils::MetaClass<T>::metadata))::value -
+      inherited_count_impl<Parents>(
+          ::std::make_index_sequence<parents_count>()); /**< Amount of own
+                                                           elements */
+
+  static constexpr auto fields{own_fields<own_count>(
+      utils::selected_indices_v<T, ObjVars>)}; /**< Indices of own object
+                                                  variables */
+
+  /**
+   * @brief Checks which fields are written as bytes
+   * @param std::index_sequence<Positions...> - positions of fields
+   * @return std::array of flags
+   */
+  template <::std::size_t... Positions>
+  static constexpr decltype(auto)
+  bytes_impl(::std::index_sequence<Positions...> &&) {
+    return ::std::array<bool, sizeof...(Positions)>{
+        {is_bytes_v<field_t<T, fields[Positions]>>...}};
+  }
+
+  static constexpr auto bytes{bytes_impl(::std::make_index_sequence<
+                                         fields.size()>())}; /**< Field is
+                                                                written as
+                                                                bytes */
+
+  /**
+   * @brief Position after last field of run of bytes fields which starts at
+   * position
+   * @param position - position of first field of run
+   */
+  static constexpr ::std::size_t run_end(::std::size_t position) {
+    while (position < bytes.size() && bytes[position])
+      ++position;
+    return position;
+  }
+
+  /**
+   * @brief Checks if field at position starts run of bytes fields
+   * @param position - position of field
+   */
+  static constexpr bool run_begin(::std::size_t position) {
+    return bytes[position] && (position == 0 || !bytes[position - 1]);
+  }
+};
+
+/**
+ * @brief Reference to field at position
+ * @param obj - object
+ */
+template <class T, ::std::size_t Position, class Obj>
+constexpr decltype(auto) field(Obj &obj) {
+  return utils::invoke<T, info::DefaultIndexGenerator>(
+      ::boost::hana::llong_c<layout<T>::fields[Position]>, obj);
+}
+
+/**
+ * @brief Checks if fields of run are placed in memory one after another
+ * without padding, so they can be copied by one memcpy
+ * @param obj - object
+ * @param std::index_sequence<Positions...> - positions of fields in run
+ * (without the last one)
+ */
+template <class T, ::std::size_t Begin, class Obj, ::std::size_t... Positions>
+bool is_contiguous(Obj &obj, ::std::index_sequence<Positions...> &&) {
+  return (true && ... &&
+          (reinterpret_cast<const unsigned char *>(::std::addressof(
+               field<T, Begin + Positions + 1>(obj))) ==
+           reinterpret_cast<const unsigned char *>(
+               ::std::addressof(field<T, Begin + Positions>(obj))) +
+               sizeof(field_t<T, layout<T>::fields[Begin + Positions]>)));
+}
+
+/**
+ * @brief Total size of fields of run
+ * @param std::index_sequence<Positions...> - positions of fields in run
+ */
+template <class T, ::std::size_t Begin, ::std::size_t... Positions>
+constexpr ::std::size_t run_size(::std::index_sequence<Positions...> &&) {
+  return (::std::size_t{0} + ... +
+          sizeof(field_t<T, layout<T>::fields[Begin + Positions]>));
+}
+
+template <class T> constexpr bool takes_bytes();
+
+/**
+ * @brief Checks if any parent or own field of reflected class takes bytes
+ * @param std::index_sequence<Parents...> - positions of parents
+ * @param std::index_sequence<Positions...> - positions of own fields
+ */
+template <class T, ::std::size_t... Parents, ::std::size_t... Positions>
+constexpr bool takes_bytes_impl(::std::index_sequence<Parents...> &&,
+                                ::std::index_sequence<Positions...> &&) {
+  return (false || ... ||
+          takes_bytes<typename metautils::tuple_item_t<
+              Parents, typename layout<T>::Parents>::type>()) ||
+         (false || ... ||
+          takes_bytes<field_t<T, layout<T>::fields[Positions]>>());
+}
+
+/**
+ * @brief Checks if serialized T takes at least one byte. Only reflected
+ * classes without object variables (including ones of parents) take none
+ */
+template <class T> constexpr bool takes_bytes() {
+  if constexpr (info::is_reflected_v<T>)
+    return takes_bytes_impl<T>(
+        ::std::make_index_sequence<layout<T>::parents_count>(),
+        ::std::make_index_sequence<layout<T>::fields.size()>());
+  else
+    return true;
+}
+
+template <class T> void write_value(Writer &writer, const T &value);
+
+template <class T> bool read_value(Reader &reader, T &value);
+
+/**
+ * @brief Writes run of bytes fields [Begin, End) with one memcpy if fields
+ * are contiguous, otherwise field by field
+ * @param std::index_sequence<Positions...> - positions of fields in run
+ */
+template <class T, ::std::size_t Begin, ::std::size_t End,
+          ::std::size_t... Positions>
+void write_run(Writer &writer, const T &obj,
+               ::std::index_sequence<Positions...> &&) {
+  if (is_contiguous<T, Begin>(obj,
+                              ::std::make_index_sequence<End - Begin - 1>()))
+    writer.write(::std::addressof(field<T, Begin>(obj)),
+                 run_size<T, Begin>(::std::make_index_sequence<End - Begin>()));
+  else
+    (writer.write(::std::addressof(field<T, Begin + Positions>(obj)),
+                  sizeof(field_t<T, layout<T>::fields[Begin + Positions]>)),
+     ...);
+}
+
+/**
+ * @brief Reads run of bytes fields [Begin, End) with one memcpy if fields
+ * are contiguous, otherwise field by field
+ * @param std::index_sequence<Positions...> - positions of fields in run
+ * @return false if there are not enough bytes
+ */
+template <class T, ::std::size_t Begin, ::std::size_t End,
+          ::std::size_t... Positions>
+bool read_run(Reader &reader, T &obj, ::std::index_sequence<Positions...> &&) {
+  if (is_contiguous<T, Begin>(obj,
+                              ::std::make_index_sequence<End - Begin - 1>()))
+    return reader.read(
+        ::std::addressof(field<T, Begin>(obj)),
+        run_size<T, Begin>(::std::make_index_sequence<End - Begin>()));
+  return (reader.read(
+              ::std::addressof(field<T, Begin + Positions>(obj)),
+              sizeof(field_t<T, layout<T>::fields[Begin + Positions]>)) &&
+          ...);
+}
+
+/**
+ * @brief Writes field at position (runs of bytes fields are written by their
+ * first field)
+ */
+template <class T, ::std::size_t Position>
+void write_field(Writer &writer, const T &obj) {
+  using Layout = layout<T>;
+  if constexpr (!Layout::bytes[Position])
+    write_value(writer, field<T, Position>(obj));
+  else if constexpr (Layout::run_begin(Position))
+    write_run<T, Position, Layout::run_end(Position)>(
+        writer, obj,
+        ::std::make_index_sequence<Layout::run_end(Position) - Position>());
+}
+
+/**
+ * @brief Reads field at position (runs of bytes fields are read by their
+ * first field)
+ * @return false if there are not enough bytes or data is invalid
+ */
+template <class T, ::std::size_t Position>
+bool read_field(Reader &reader, T &obj) {
+  using Layout = layout<T>;
+  static_assert(!::std::is_const_v<::std::remove_reference_t<decltype(
+                    field<T, Position>(obj))>>,
+                "Const variables can't be deserialized");
+  if constexpr (!Layout::bytes[Position])
+    return read_value(reader, field<T, Position>(obj));
+  else if constexpr (Layout::run_begin(Position))
+    return read_run<T, Position, Layout::run_end(Position)>(
+        reader, obj,
+        ::std::make_index_sequence<Layout::run_end(Position) - Position>());
+  else
+    return true;
+}
+
+/**
+ * @brief Writes parents and own object variables of reflected class
+ * @param std::index_sequence<Parents...> - positions of parents
+ * @param std::index_sequence<Positions...> - positions of own fields
+ */
+template <class T, ::std::size_t... Parents, ::std::size_t... Positions>
+void write_object(Writer &writer, const T &obj,
+                  ::std::index_sequence<Parents...> &&,
+                  ::std::index_sequence<Positions...> &&) {
+  (write_value(writer,
+               static_cast<const typename metautils::tuple_item_t<
+                   Parents, typename layout<T>::Parents>::type &>(obj)),
+   ...);
+  (write_field<T, Positions>(writer, obj), ...);
+}
+
+/**
+ * @brief Reads parents and own object variables of reflected class
+ * @param std::index_sequence<Parents...> - positions of parents
+ * @param std::index_sequence<Positions...> - positions of own fields
+ * @return false if there are not enough bytes or data is invalid
+ */
+template <class T, ::std::size_t... Parents, ::std::size_t... Positions>
+bool read_object(Reader &reader, T &obj, ::std::index_sequence<Parents...> &&,
+                 ::std::index_sequence<Positions...> &&) {
+  return (true && ... &&
+          read_value(reader,
+                     static_cast<typename metautils::tuple_item_t<
+                         Parents, typename layout<T>::Parents>::type &>(
+                         obj))) &&
+         (true && ... && read_field<T, Positions>(reader, obj));
+}
+
+/**
+ * @brief Writes value: reflected class, std::string, std::vector, view or
+ * trivially copyable value
+ */
+template <class T> void write_value(Writer &writer, const T &value) {
+  if constexpr (info::is_reflected_v<T>)
+    write_object(
+        writer, value, ::std::make_index_sequence<layout<T>::parents_count>(),
+        ::std::make_index_sequence<layout<T>::fields.size()>());
+  else if constexpr (metautils::is_string_v<T> || metautils::is_vector_v<T>) {
+    using Item = typename T::value_type;
+    size_type size = value.size();
+    writer.write(&size, sizeof(size));
+    if constexpr (is_bytes_v<Item> && !::std::is_same_v<Item, bool>)
+      writer.write(value.data(), value.size() * sizeof(Item));
+    else
+      for (const Item &item : value)
+        write_value(writer, item);
+  } else if constexpr (metautils::is_view_v<T>) {
+    static_assert(sizeof(*value.data()) == 1,
+                  "Only views of chars or bytes can be serialized");
+    size_type size = value.size();
+    writer.write(&size, sizeof(size));
+    writer.write(value.data(), value.size());
+  } else {
+    static_assert(is_bytes_v<T>, "Type can't be serialized");
+    writer.write(::std::addressof(value), sizeof(T));
+  }
+}
+
+/**
+ * @brief Reads value: reflected class, std::string, std::vector, view (points
+ * into input) or trivially copyable value
+ * @return false if there are not enough bytes or data is invalid
+ */
+template <class T> bool read_value(Reader &reader, T &value) {
+  if constexpr (info::is_reflected_v<T>)
+    return read_object(
+        reader, value, ::std::make_index_sequence<layout<T>::parents_count>(),
+        ::std::make_index_sequence<layout<T>::fields.size()>());
+  else if constexpr (metautils::is_string_v<T> || metautils::is_vector_v<T>) {
+    using Item = typename T::value_type;
+    size_type size = 0;
+    // element which takes at least one byte can't be repeated more than
+    // remaining bytes, so the size is checked before memory is allocated
+    constexpr bool sized = takes_bytes<Item>();
+    if (!reader.read(&size, sizeof(size)) ||
+        size > (sized ? reader.remaining() : max_empty_elements) ||
+        size > value.max_size())
+      return false;
+    utils::use_memory_resource(value, reader.resource());
+    if constexpr (is_bytes_v<Item> && !::std::is_same_v<Item, bool>) {
+      if (size > reader.remaining() / sizeof(Item))
+        return false;
+      value.resize(static_cast<::std::size_t>(size));
+      return reader.read(value.data(), value.size() * sizeof(Item));
+    } else {
+      value.clear();
+      value.reserve(static_cast<::std::size_t>(size));
+      for (size_type i = 0; i < size; ++i) {
+        Item item{};
+        if (!read_value(reader, item))
+          return false;
+        value.push_back(::std::move(item));
+      }
+      return true;
+    }
+  } else if constexpr (metautils::is_view_v<T>) {
+    using Item = ::std::remove_reference_t<decltype(*value.data())>;
+    static_assert(sizeof(Item) == 1 && ::std::is_const_v<Item>,
+                  "Only views of const chars or bytes can be deserialized");
+    size_type size = 0;
+    const char *data = nullptr;
+    if (!reader.read(&size, sizeof(size)) || size > reader.remaining() ||
+        !reader.borrow(data, static_cast<::std::size_t>(size)))
+      return false;
+    value = T(reinterpret_cast<Item *>(data), static_cast<::std::size_t>(size));
+    return true;
+  } else {
+    static_assert(is_bytes_v<T>, "Type can't be deserialized");
+    return reader.read(::std::addressof(value), sizeof(T));
+  }
+}
+} // namespace detail
+
+/**
+ * @brief Serializes value and appends it to buffer
+ * @param value - reflected object (or std::string, std::vector, trivially
+ * copyable value)
+ * @param buffer - output buffer
+ */
+template <class T> void serialize(const T &value, ::std::string &buffer) {
+  Writer writer(buffer);
+  detail::write_value(writer, value);
+}
+
+/**
+ * @brief Serializes value
+ * @param value - reflected object (or std::string, std::vector, trivially
+ * copyable value)
+ * @return std::string with bytes
+ */
+template <class T> ::std::string serialize(const T &value) {
+  ::std::string buffer;
+  serialize(value, buffer);
+  return buffer;
+}
+
+/**
+ * @brief Deserializes value from reader
+ * @param reader - input
+ * @param value - output value
+ * @return false if there are not enough bytes or data is invalid
+ */
+template <class T> bool deserialize(Reader &reader, T &value) {
+  return detail::read_value(reader, value);
+}
+
+/**
+ * @brief Deserializes value, all bytes must be read
+ * @param data - input bytes
+ * @param value - output value
+ * @param resource - memory resource of std::pmr containers (nullptr -
+ * containers keep their allocators)
+ * @return false if there are not enough bytes, data is invalid or not all
+ * bytes are read
+ */
+template <class T>
+bool deserialize(::std::string_view data, T &value,
+                 ::std::pmr::memory_resource *resource = nullptr) {
+  Reader reader(data, resource);
+  return detail::read_value(reader, value) && reader.remaining() == 0;
+}
+
+/**
+ * @brief Deserializes value from temporary string, borrowing types are
+ * forbidden, because their views would point into destroyed string
+ * @param data - input bytes
+ * @param value - output value
+ * @param resource - memory resource of std::pmr containers
+ * @return false if there are not enough bytes, data is invalid or not all
+ * bytes are read
+ */
+template <class T, class String,
+          ::std::enable_if_t<::std::is_same_v<String, ::std::string>, int> = 0>
+bool deserialize(String &&data, T &value,
+                 ::std::pmr::memory_resource *resource = nullptr) {
+  static_assert(!utils::is_borrowing_v<T>,
+                "Borrowing type can't be deserialized from temporary string");
+  return deserialize(::std::string_view(data), value, resource);
+}
+} // namespace binary
+} // namespace reflect
+
+#endif // REFLECT_BINARY_HPP
@@ -0,0 +1,179 @@
+#ifndef REFLECT_DELTA_HPP
+#define REFLECT_DELTA_HPP
+
+#include "../meta_utils/meta_utils.hpp"
+#include "../reflect_information/reflect_information.hpp"
+#include "../reflect_utils/reflect_utils.hpp"
+#include "reflect_binary.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace reflect {
+
+namespace binary {
+
+namespace detail {
+
+/**
+ * @brief Writes object variables which bits are set in mask
+ * @param std::index_sequence<Positions...> - positions of object variables
+ */
+template <class T, class Mask, ::std::size_t... Positions>
+void write_delta(Writer &writer, const T &obj, const Mask &mask,
+                 ::std::index_sequence<Positions...> &&) {
+  ((mask.test(Positions)
+        ? write_value(writer, utils::invoke<T, ObjVars>(
+                                  ::boost::hana::llong_c<Positions>, obj))
+        : void()),
+   ...);
+}
+
+/**
+ * @brief Reads object variables which bits are set in mask
+ * @param std::index_sequence<Positions...> - positions of object variables
+ * @return false if there are not enough bytes or data is invalid
+ */
+template <class T, class Mask, ::std::size_t... Positions>
+bool read_delta(Reader &reader, T &obj, const Mask &mask,
+                ::std::index_sequence<Positions...> &&) {
+  return (true && ... &&
+          (!mask.test(Positions) ||
+           read_value(reader, utils::invoke<T, ObjVars>(
+                                  ::boost::hana::llong_c<Positions>, obj))));
+}
+
+/**
+ * @brief Reads mask of delta, bits after last object variable must be zero
+ * @return false if there are not enough bytes or mask is invalid
+ */
+template <class Mask> bool read_mask(Reader &reader, Mask &mask) {
+  for (auto &word : mask.words())
+    if (!reader.read(&word, sizeof(word)))
+      return false;
+  if constexpr (Mask::size() % Mask::word_bits != 0)
+    return (mask.words().back() >> (Mask::size() % Mask::word_bits)) == 0;
+  else
+    return true;
+}
+} // namespace detail
+
+/**
+ * @brief Serializes object variables which bits are set in mask and appends
+ * them to buffer. Delta is mask (member_mask_t<T>::words_count of
+ * std::uint64_t, bit i is object variable at position i in ObjVars order)
+ * followed by selected variables in ObjVars order
+ * @param value - reflected object
+ * @param mask - mask of object variables
+ * @param buffer - output buffer
+ */
+template <class T>
+void serialize_delta(const T &value, const utils::member_mask_t<T> &mask,
+                     ::std::string &buffer) {
+  Writer writer(buffer);
+  for (auto word : mask.words())
+    writer.write(&word, sizeof(word));
+  if (utils::is_dense(mask))
+    detail::write_delta(
+        writer, value, mask,
+        ::std::make_index_sequence<utils::member_mask_t<T>::size()>());
+  else
+    utils::visit_masked<T, detail::ObjVars>(
+        value, mask, [&writer](auto index, const T &obj) {
+          detail::write_value(
+              writer, utils::invoke<T, detail::ObjVars>(index, obj));
+          return true;
+        });
+}
+
+/**
+ * @brief Serializes object variables which differ from baseline and appends
+ * them to buffer
+ * @param baseline - object known to receiver
+ * @param value - reflected object
+ * @param buffer - output buffer
+ */
+template <class T>
+void serialize_delta(const T &baseline, const T &value,
+                     ::std::string &buffer) {
+  serialize_delta(value, utils::diff(baseline, value), buffer);
+}
+
+/**
+ * @brief Serializes object variables which differ from baseline
+ * @param baseline - object known to receiver
+ * @param value - reflected object
+ * @return std::string with bytes
+ */
+template <class T>
+::std::string serialize_delta(const T &baseline, const T &value) {
+  ::std::string buffer;
+  serialize_delta(baseline, value, buffer);
+  return buffer;
+}
+
+/**
+ * @brief Deserializes delta from reader and patches baseline in place. If
+ * data is invalid, baseline may be partially patched
+ * @param reader - input
+ * @param baseline - patched object
+ * @return false if there are not enough bytes or data is invalid
+ */
+template <class T> bool deserialize_delta(Reader &reader, T &baseline) {
+  utils::member_mask_t<T> mask;
+  if (!detail::read_mask(reader, mask))
+    return false;
+  if (utils::is_dense(mask))
+    return detail::read_delta(
+        reader, baseline, mask,
+        ::std::make_index_sequence<utils::member_mask_t<T>::size()>());
+  return utils::visit_masked<T, detail::ObjVars>(
+      baseline, mask, [&reader](auto index, T &obj) {
+        return detail::read_value(
+            reader, utils::invoke<T, detail::ObjVars>(index, obj));
+      });
+}
+
+/**
+ * @brief Deserializes delta and patches baseline in place, all bytes must be
+ * read. If data is invalid, baseline may be partially patched
+ * @param data - input bytes
+ * @param baseline - patched object
+ * @param resource - memory resource of std::pmr containers (nullptr -
+ * containers keep their allocators)
+ * @return false if there are not enough bytes, data is invalid or not all
+ * bytes are read
+ */
+template <class T>
+bool deserialize_delta(::std::string_view data, T &baseline,
+                       ::std::pmr::memory_resource *resource = nullptr) {
+  Reader reader(data, resource);
+  return deserialize_delta(reader, baseline) && reader.remaining() == 0;
+}
+
+/**
+ * @brief Names of object variables contained in delta (for debug output)
+ * @param data - input bytes
+ * @return std::vector of names in ObjVars order, empty if mask is invalid
+ */
+template <class T>
+::std::vector<::std::string_view> delta_names(::std::string_view data) {
+  static constexpr auto names{metautils::ct_string_views(
+      utils::selected_names_v<T, detail::ObjVars>)};
+  utils::member_mask_t<T> mask;
+  Reader reader(data);
+  ::std::vector<::std::string_view> result;
+  if (detail::read_mask(reader, mask))
+    for (::std::size_t i = 0; i < mask.size(); ++i)
+      if (mask.test(i))
+        result.push_back(names[i]);
+  return result;
+}
+} // namespace binary
+} // namespace reflect
+
+#endif // REFLECT_DELTA_HPP
@@ -0,0 +1,931 @@
+#ifndef REFLECT_JSON_HPP
+#define REFLECT_JSON_HPP
+
+#include "../meta_utils/meta_utils.hpp"
+#include "../reflect_information/reflect_information.hpp"
+#include "../reflect_utils/reflect_utils.hpp"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace reflect {
+
+/**
+ * @brief Namespace related to JSON serialization of reflected classes.
+ * Reflected classes are written as objects of their object variables
+ * (including variables of parents), std::vector as arrays, std::string and
+ * char as strings, bool as true/false, reflected enums (REFLECT_ENUM) as
+ * names, flag sets (REFLECT_FLAGS) as names of flags separated by '|', values
+ * without name, other arithmetic types and enums as numbers (not finite
+ * floating point values as null). Reader dispatches keys of objects to object
+ * variables by perfect hash of names and skips unknown keys, std::string_view
+ * variables point into input
+ */
+namespace json {
+
+namespace detail {
+
+using ObjVars = info::ObjectIndexGenerator<info::VariableIndexGenerator<
+    info::DefaultIndexGenerator>>; /**< Object variables */
+
+/**
+ * @brief Key of object member with leading '{' (first member) or ',' and
+ * trailing ':'
+ */
+template <bool First, class String> struct quoted_key;
+
+/**
+ * @brief Key of object member (template spetialization for
+ * boost::hana::string)
+ */
+template <bool First, char... s>
+struct quoted_key<First, ::boost::hana::string<s...>> {
+  static constexpr char value[] = {First ? '{' : ',', '"', s..., '"',
+                                   ':'}; /**< Quoted key */
+};
+
+/**
+ * @brief Table of escape sequences: 0 - char is written as is, 'u' - char is
+ * written as \u00XX, other - char is written as backslash and this char
+ */
+constexpr ::std::array<char, 256> escape_table() {
+  ::std::array<char, 256> table{};
+  for (::std::size_t c = 0; c < 0x20; ++c)
+    table[c] = 'u';
+  table['"'] = '"';
+  table['\\'] = '\\';
+  table['\b'] = 'b';
+  table['\f'] = 'f';
+  table['\n'] = 'n';
+  table['\r'] = 'r';
+  table['\t'] = 't';
+  return table;
+}
+
+constexpr auto escapes{escape_table()}; /**< Escape sequences */
+
+/**
+ * @brief Word of 8 bytes equal to byte
+ */
+constexpr ::std::uint64_t broadcast(unsigned char byte) {
+  return 0x0101010101010101ull * byte;
+}
+
+/**
+ * @brief Checks if any of 8 bytes of word has to be escaped (control
+ * character, quote or backslash), all bytes are checked at once
+ */
+constexpr bool needs_escape(::std::uint64_t word) {
+  auto less = [](::std::uint64_t value, unsigned char byte) {
+    return (value - broadcast(byte)) & ~value & broadcast(0x80);
+  };
+  return (less(word, 0x20) | less(word ^ broadcast('"'), 1) |
+          less(word ^ broadcast('\\'), 1)) != 0;
+}
+
+/**
+ * @brief Writes escaped string. Chars are checked by words of 8 bytes, runs of
+ * chars without escapes are appended at once
+ * @param buffer - output buffer
+ * @param str - string
+ */
+inline void write_string(::std::string &buffer, ::std::string_view str) {
+  constexpr char hex[] = "0123456789abcdef";
+  const char *data = str.data();
+  ::std::size_t begin = 0;
+  ::std::size_t i = 0;
+  buffer.push_back('"');
+  while (i < str.size()) {
+    if (str.size() - i >= sizeof(::std::uint64_t)) {
+      ::std::uint64_t word;
+      ::std::memcpy(&word, data + i, sizeof(word));
+      if (!needs_escape(word)) {
+        i += sizeof(word);
+        continue;
+      }
+    }
+    char escape = escapes[static_cast<unsigned char>(data[i])];
+    if (escape) {
+      buffer.append(data + begin, i - begin);
+      if (escape == 'u') {
+        const char sequence[] = {'\\', 'u', '0', '0', hex[data[i] >> 4],
+                                 hex[data[i] & 0xf]};
+        buffer.append(sequence, sizeof(sequence));
+      } else {
+        const char sequence[] = {'\\', escape};
+        buffer.append(sequence, sizeof(sequence));
+      }
+      begin = i + 1;
+    }
+    ++i;
+  }
+  buffer.append(data + begin, str.size() - begin);
+  buffer.push_back('"');
+}
+
+/**
+ * @brief Writes number with std::to_chars
+ * @param buffer - output buffer
+ * @param value - integer or floating point value
+ */
+template <class T> void write_number(::std::string &buffer, T value) {
+  if constexpr (::std::is_floating_point_v<T>)
+    if (!::std::isfinite(value)) {
+      buffer.append("null", 4);
+      return;
+    }
+  char chars[64];
+  auto result = ::std::to_chars(chars, chars + sizeof(chars), value);
+  buffer.append(chars, static_cast<::std::size_t>(result.ptr - chars));
+}
+
+template <class T> void write_value(::std::string &buffer, const T &value);
+
+/**
+ * @brief Writes object variables of reflected class as JSON object
+ * @param std::index_sequence<Positions...> - positions of object variables
+ */
+template <class T, ::std::size_t... Positions>
+void write_object(::std::string &buffer, const T &obj,
+                  ::std::index_sequence<Positions...> &&) {
+  using Names = ::std::decay_t<decltype(utils::selected_names_v<T, ObjVars>)>;
+  if constexpr (sizeof...(Positions) == 0)
+    buffer.append("{}", 2);
+  else {
+    ((buffer.append(
+          quoted_key<Positions == 0,
+                     metautils::tuple_item_t<Positions, Names>>::value,
+          sizeof(quoted_key<Positions == 0,
+                            metautils::tuple_item_t<Positions, Names>>::value)),
+      write_value(buffer, utils::invoke<T, ObjVars>(
+                              ::boost::hana::llong_c<Positions>, obj))),
+     ...);
+    buffer.push_back('}');
+  }
+}
+
+/**
+ * @brief Writes value: reflected class, std::vector, string, arithmetic value
+ * or enum (reflected enum as name if value has name)
+ */
+template <class T> void write_value(::std::string &buffer, const T &value) {
+  if constexpr (info::is_reflected_v<T>)
+    write_object(
+        buffer, value,
+        ::std::make_index_sequence<utils::selected_count_v<T, ObjVars>>());
+  else if constexpr (metautils::is_vector_v<T>) {
+    buffer.push_back('[');
+    bool first = true;
+    for (const typename T::value_type &item : value) {
+      if (!first)
+        buffer.push_back(',');
+      first = false;
+      write_value(buffer, item);
+    }
+    buffer.push_back(']');
+  } else if constexpr (metautils::is_string_v<T> ||
+                       ::std::is_same_v<T, ::std::string_view>)
+    write_string(buffer, ::std::string_view(value.data(), value.size()));
+  else if constexpr (::std::is_same_v<T, char>)
+    write_string(buffer, ::std::string_view(&value, 1));
+  else if constexpr (::std::is_same_v<T, bool>)
+    value ? buffer.append("true", 4) : buffer.append("false", 5);
+  else if constexpr (info::is_flags_enum_v<T>) {
+    buffer.push_back('"');
+    if (utils::flags_to_string(value, buffer))
+      buffer.push_back('"');
+    else {
+      buffer.pop_back();
+      write_number(buffer, static_cast<::std::underlying_type_t<T>>(value));
+    }
+  } else if constexpr (info::is_reflected_enum_v<T>) {
+    const ::std::string_view name = utils::enum_to_string(value);
+    if (!name.empty()) {
+      buffer.push_back('"');
+      buffer.append(name);
+      buffer.push_back('"');
+    } else
+      write_number(buffer, static_cast<::std::underlying_type_t<T>>(value));
+  } else if constexpr (::std::is_enum_v<T>)
+    write_number(buffer, static_cast<::std::underlying_type_t<T>>(value));
+  else {
+    static_assert(::std::is_arithmetic_v<T>, "Type can't be serialized");
+    write_number(buffer, value);
+  }
+}
+
+/**
+ * @brief Finds first char which has to be escaped (control character, quote or
+ * backslash), chars are checked by words of 8 bytes
+ * @param begin - first char
+ * @param end - char after last one
+ * @return pointer to found char or end
+ */
+inline const char *find_escape(const char *begin, const char *end) {
+  for (::std::uint64_t word; end - begin >= 8; begin += 8) {
+    ::std::memcpy(&word, begin, sizeof(word));
+    if (needs_escape(word))
+      break;
+  }
+  while (begin != end && !escapes[static_cast<unsigned char>(*begin)])
+    ++begin;
+  return begin;
+}
+
+/**
+ * @brief Output of in situ unescaping, unescaped chars are written over
+ * escaped input (unescaped string is never longer than escaped one)
+ */
+struct InsituOutput {
+  char *current; /**< Next char to write */
+
+  /**
+   * @brief Writes char
+   */
+  void push_back(char c) { *current++ = c; }
+
+  /**
+   * @brief Writes chars, they may overlap with output
+   */
+  void append(const char *data, ::std::size_t size) {
+    ::std::memmove(current, data, size);
+    current += size;
+  }
+};
+
+/**
+ * @brief Appends code point as UTF-8
+ * @param str - output string (std::string or InsituOutput)
+ * @param code - code point
+ */
+template <class Output> void append_utf8(Output &str, ::std::uint32_t code) {
+  if (code < 0x80)
+    str.push_back(static_cast<char>(code));
+  else if (code < 0x800) {
+    const char chars[] = {static_cast<char>(0xc0 | code >> 6),
+                          static_cast<char>(0x80 | (code & 0x3f))};
+    str.append(chars, sizeof(chars));
+  } else if (code < 0x10000) {
+    const char chars[] = {static_cast<char>(0xe0 | code >> 12),
+                          static_cast<char>(0x80 | (code >> 6 & 0x3f)),
+                          static_cast<char>(0x80 | (code & 0x3f))};
+    str.append(chars, sizeof(chars));
+  } else {
+    const char chars[] = {static_cast<char>(0xf0 | code >> 18),
+                          static_cast<char>(0x80 | (code >> 12 & 0x3f)),
+                          static_cast<char>(0x80 | (code >> 6 & 0x3f)),
+                          static_cast<char>(0x80 | (code & 0x3f))};
+    str.append(chars, sizeof(chars));
+  }
+}
+
+/**
+ * @brief Parses JSON text, every step checks bounds of input
+ */
+class Parser final {
+public:
+  /**
+   * @brief Constructor
+   * @param input - JSON text
+   * @param insitu - input is mutable, so borrowed strings with escape
+   * sequences are unescaped in place
+   * @param resource - memory resource of std::pmr containers (nullptr -
+   * containers keep their allocators)
+   */
+  explicit Parser(::std::string_view input, bool insitu = false,
+                  ::std::pmr::memory_resource *resource = nullptr) noexcept
+      : current_(input.data()), end_(input.data() + input.size()),
+        insitu_(insitu), resource_(resource) {}
+
+  /**
+   * @brief Memory resource of std::pmr containers
+   */
+  ::std::pmr::memory_resource *resource() const noexcept { return resource_; }
+
+  /**
+   * @brief Skips whitespaces
+   * @return false if input ends
+   */
+  bool skip_whitespace() {
+    while (current_ != end_ && (*current_ == ' ' || *current_ == '\n' ||
+                                *current_ == '\r' || *current_ == '\t'))
+      ++current_;
+    return current_ != end_;
+  }
+
+  /**
+   * @brief Skips whitespaces and char c
+   * @return false if next char isn't c
+   */
+  bool consume(char c) {
+    if (!skip_whitespace() || *current_ != c)
+      return false;
+    ++current_;
+    return true;
+  }
+
+  /**
+   * @brief Skips whitespaces and literal (true, false, null)
+   * @return false if next chars aren't literal
+   */
+  bool consume(::std::string_view literal) {
+    if (!skip_whitespace() ||
+        static_cast<::std::size_t>(end_ - current_) < literal.size() ||
+        ::std::string_view(current_, literal.size()) != literal)
+      return false;
+    current_ += literal.size();
+    return true;
+  }
+
+  /**
+   * @brief Checks if only whitespaces are left
+   */
+  bool at_end() { return !skip_whitespace(); }
+
+  /**
+   * @brief Current char, after failed skip_value it's equal to end of input if
+   * input ends inside of value
+   */
+  const char *position() const noexcept { return current_; }
+
+  /**
+   * @brief Parses number with std::from_chars. Number is checked against JSON
+   * grammar first, because std::from_chars also accepts inf, nan and leading
+   * zeros
+   * @param value - output integer or floating point value
+   * @return false if there is no number of type T
+   */
+  template <class T> bool parse_number(T &value) {
+    if (!skip_whitespace())
+      return false;
+    bool valid = false;
+    const char *end = number_end(valid);
+    if (!valid)
+      return false;
+    auto result = ::std::from_chars(current_, end, value);
+    if (result.ec != ::std::errc{} || result.ptr != end)
+      return false;
+    current_ = end;
+    return true;
+  }
+
+  /**
+   * @brief Parses string. If string has no escape sequences, value points to
+   * input, otherwise it's unescaped to storage and value points to storage
+   * @param value - output view of string
+   * @param storage - storage for unescaped string
+   * @return false if there is no valid string
+   */
+  bool parse_string(::std::string_view &value, ::std::string &storage) {
+    if (!consume('"'))
+      return false;
+    const char *begin = current_;
+    const char *escape = find_escape(current_, end_);
+    if (escape != end_ && *escape == '"') {
+      value = ::std::string_view(begin,
+                                 static_cast<::std::size_t>(escape - begin));
+      current_ = escape + 1;
+      return true;
+    }
+    storage.assign(begin, static_cast<::std::size_t>(escape - begin));
+    current_ = escape;
+    if (!unescape(storage))
+      return false;
+    value = storage;
+    return true;
+  }
+
+  /**
+   * @brief Parses string
+   * @param value - output string (std::basic_string of chars)
+   * @return false if there is no valid string
+   */
+  template <class String> bool parse_string(String &value) {
+    if (!consume('"'))
+      return false;
+    const char *escape = find_escape(current_, end_);
+    value.assign(current_, static_cast<::std::size_t>(escape - current_));
+    current_ = escape;
+    return unescape(value);
+  }
+
+  /**
+   * @brief Parses string without copying: value points to input. String with
+   * escape sequences is unescaped in place if input is mutable, otherwise it
+   * can't be borrowed
+   * @param value - output view of string
+   * @return false if there is no valid string or it can't be borrowed
+   */
+  bool borrow_string(::std::string_view &value) {
+    if (!consume('"'))
+      return false;
+    const char *begin = current_;
+    const char *escape = find_escape(current_, end_);
+    if (escape != end_ && *escape == '"') {
+      value = ::std::string_view(begin,
+                                 static_cast<::std::size_t>(escape - begin));
+      current_ = escape + 1;
+      return true;
+    }
+    if (!insitu_)
+      return false;
+    // input is mutable, see constructor
+    InsituOutput output{const_cast<char *>(escape)};
+    current_ = escape;
+    if (!unescape(output))
+      return false;
+    value = ::std::string_view(
+        begin, static_cast<::std::size_t>(output.current - begin));
+    return true;
+  }
+
+  /**
+   * @brief Skips any value without storing it. Strings are skipped by words,
+   * objects and arrays are checked with stack of closing brackets: elements
+   * have to be separated by ',', keys have to be strings followed by ':'
+   * @return false if there is no valid value
+   */
+  bool skip_value() {
+    ::std::string closing; // closing brackets of open objects and arrays
+    for (;;) {
+      if (!skip_whitespace())
+        return false;
+      if (*current_ == '{' || *current_ == '[') {
+        closing.push_back(*current_ == '{' ? '}' : ']');
+        ++current_;
+        if (!skip_whitespace())
+          return false;
+        if (*current_ != closing.back()) {
+          if (closing.back() == '}' && !skip_key())
+            return false;
+          continue;
+        }
+        ++current_;
+        closing.pop_back();
+      } else if (!skip_scalar())
+        return false;
+      for (;;) {
+        if (closing.empty())
+          return true;
+        if (!skip_whitespace())
+          return false;
+        if (*current_ != closing.back())
+          break;
+        ++current_;
+        closing.pop_back();
+      }
+      if (*current_ != ',')
+        return false;
+      ++current_;
+      if (closing.back() == '}' && !skip_key())
+        return false;
+    }
+  }
+
+private:
+  /**
+   * @brief Skips string, literal (true, false, null) or number, current_
+   * points to its first char
+   * @return false if there is no valid value
+   */
+  bool skip_scalar() {
+    if (*current_ == '"')
+      return skip_string();
+    for (::std::string_view literal : {"true", "false", "null"}) {
+      ::std::size_t size = ::std::min(
+          literal.size(), static_cast<::std::size_t>(end_ - current_));
+      if (::std::string_view(current_, size) == literal.substr(0, size)) {
+        // input ends inside of literal if size is less than literal size
+        current_ += size;
+        return size == literal.size();
+      }
+    }
+    bool valid = false;
+    const char *end = number_end(valid);
+    if (valid || end == end_)
+      current_ = end;
+    return valid;
+  }
+
+  /**
+   * @brief Skips object key and ':' after it
+   * @return false if there is no string key followed by ':'
+   */
+  bool skip_key() {
+    return skip_whitespace() && *current_ == '"' && skip_string() &&
+           consume(':');
+  }
+
+  /**
+   * @brief Finds end of number which starts at current_, number has to match
+   * -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+   * @param valid - output flag, false if there is no valid number
+   * @return end of number or char where number became invalid (end of input
+   * if input ends inside of number)
+   */
+  const char *number_end(bool &valid) const noexcept {
+    auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+    auto skip_digits = [this, &is_digit](const char *it) {
+      while (it != end_ && is_digit(*it))
+        ++it;
+      return it;
+    };
+    const char *it = current_;
+    if (it != end_ && *it == '-')
+      ++it;
+    if (it == end_ || !is_digit(*it))
+      return it;
+    it = *it == '0' ? it + 1 : skip_digits(it);
+    if (it != end_ && *it == '.') {
+      if (++it == end_ || !is_digit(*it))
+        return it;
+      it = skip_digits(it);
+    }
+    if (it != end_ && (*it == 'e' || *it == 'E')) {
+      if (++it != end_ && (*it == '+' || *it == '-'))
+        ++it;
+      if (it == end_ || !is_digit(*it))
+        return it;
+      it = skip_digits(it);
+    }
+    valid = true;
+    return it;
+  }
+
+  /**
+   * @brief Appends rest of string to value, current_ points to first char
+   * which has to be escaped
+   * @param value - output string (std::string or InsituOutput)
+   * @return false if string is invalid
+   */
+  template <class Output> bool unescape(Output &value) {
+    while (current_ != end_) {
+      char c = *current_++;
+      if (c == '"')
+        return true;
+      if (c != '\\' || current_ == end_)
+        return false;
+      switch (*current_++) {
+      case '"':
+        value.push_back('"');
+        break;
+      case '\\':
+        value.push_back('\\');
+        break;
+      case '/':
+        value.push_back('/');
+        break;
+      case 'b':
+        value.push_back('\b');
+        break;
+      case 'f':
+        value.push_back('\f');
+        break;
+      case 'n':
+        value.push_back('\n');
+        break;
+      case 'r':
+        value.push_back('\r');
+        break;
+      case 't':
+        value.push_back('\t');
+        break;
+      case 'u': {
+        ::std::uint32_t code = 0;
+        if (!parse_code_unit(code))
+          return false;
+        if (code >= 0xd800 && code < 0xdc00) {
+          ::std::uint32_t low = 0;
+          if (!consume_escape_u() || !parse_code_unit(low) || low < 0xdc00 ||
+              low >= 0xe000)
+            return false;
+          code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+        } else if (code >= 0xdc00 && code < 0xe000)
+          return false;
+        append_utf8(value, code);
+        break;
+      }
+      default:
+        return false;
+      }
+      const char *escape = find_escape(current_, end_);
+      value.append(current_, static_cast<::std::size_t>(escape - current_));
+      current_ = escape;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Skips "\u" of second code unit of surrogate pair
+   */
+  bool consume_escape_u() {
+    if (end_ - current_ < 2 || current_[0] != '\\' || current_[1] != 'u')
+      return false;
+    current_ += 2;
+    return true;
+  }
+
+  /**
+   * @brief Parses 4 hex digits of \u escape sequence
+   * @param code - output code unit
+   */
+  bool parse_code_unit(::std::uint32_t &code) {
+    if (end_ - current_ < 4)
+      return false;
+    auto result = ::std::from_chars(current_, current_ + 4, code, 16);
+    if (result.ptr != current_ + 4)
+      return false;
+    current_ += 4;
+    return true;
+  }
+
+  /**
+   * @brief Skips string
+   * @return false if string is invalid
+   */
+  bool skip_string() {
+    ++current_;
+    while ((current_ = find_escape(current_, end_)) != end_) {
+      char c = *current_++;
+      if (c == '"')
+        return true;
+      if (c != '\\' || current_ == end_)
+        return false;
+      ++current_;
+    }
+    return false;
+  }
+
+  const char *current_;                   /**< Current char */
+  const char *end_;                       /**< Char after last one */
+  bool insitu_;                           /**< Input is mutable */
+  ::std::pmr::memory_resource *resource_; /**< Memory resource */
+};
+
+template <class T> bool read_value(Parser &parser, T &value);
+
+/**
+ * @brief Reads object variable at position
+ * @return false if value is invalid
+ */
+template <class T, ::std::size_t Position>
+bool read_member(Parser &parser, T &obj) {
+  static_assert(
+      !::std::is_const_v<::std::remove_reference_t<decltype(utils::invoke<
+          T, ObjVars>(::boost::hana::llong_c<Position>, obj))>>,
+      "Const variables can't be deserialized");
+  return read_value(parser, utils::invoke<T, ObjVars>(
+                                ::boost::hana::llong_c<Position>, obj));
+}
+
+/**
+ * @brief Readers of object variables
+ * @param std::index_sequence<Positions...> - positions of object variables
+ * @return std::array of function pointers
+ */
+template <class T, ::std::size_t... Positions>
+constexpr decltype(auto)
+member_readers(::std::index_sequence<Positions...> &&) {
+  return ::std::array<bool (*)(Parser &, T &), sizeof...(Positions)>{
+      {&read_member<T, Positions>...}};
+}
+
+/**
+ * @brief Compile-time data to dispatch keys of JSON object to object
+ * variables of T
+ */
+template <class T> struct key_data {
+  static constexpr ::std::size_t size =
+      utils::selected_count_v<T, ObjVars>; /**< Amount of object variables */
+  static constexpr auto names{metautils::ct_string_views(
+      utils::selected_names_v<T, ObjVars>)}; /**< Names of object variables */
+  static constexpr metautils::perfect_hash<size> hash{
+      utils::detail::copy_hashes_sequence(
+          utils::MetaClass<T>::name_hashes,
+          utils::selected_indices_v<T, ObjVars>)}; /**< Perfect hash of names
+                                                    */
+  static constexpr auto readers{member_readers<T>(
+      ::std::make_index_sequence<size>())}; /**< Reader of every object
+                                               variable */
+};
+
+/**
+ * @brief Reads JSON object to reflected class: key is dispatched to object
+ * variable by perfect hash, unknown keys are skipped
+ * @return false if object is invalid
+ */
+template <class T> bool read_object(Parser &parser, T &obj) {
+  using Data = key_data<T>;
+  if (!parser.consume('{'))
+    return false;
+  if (parser.consume('}'))
+    return true;
+  ::std::string storage;
+  do {
+    ::std::string_view key;
+    if (!parser.parse_string(key, storage) || !parser.consume(':'))
+      return false;
+    ::std::uint32_t index = Data::hash.find(metautils::string_hash(key));
+    if (index != Data::hash.npos && Data::names[index] == key) {
+      if (!Data::readers[index](parser, obj))
+        return false;
+    } else if (!parser.skip_value())
+      return false;
+  } while (parser.consume(','));
+  return parser.consume('}');
+}
+
+/**
+ * @brief Reads value: reflected class, std::vector, string, std::string_view
+ * (points into input), arithmetic value or enum (reflected enum by name or
+ * number)
+ * @return false if value is invalid
+ */
+template <class T> bool read_value(Parser &parser, T &value) {
+  if constexpr (info::is_reflected_v<T>)
+    return read_object(parser, value);
+  else if constexpr (metautils::is_vector_v<T>) {
+    utils::use_memory_resource(value, parser.resource());
+    value.clear();
+    if (!parser.consume('['))
+      return false;
+    if (parser.consume(']'))
+      return true;
+    do {
+      if constexpr (::std::is_same_v<typename T::value_type, bool>) {
+        bool item = false;
+        if (!read_value(parser, item))
+          return false;
+        value.push_back(item);
+      } else {
+        value.emplace_back();
+        if (!read_value(parser, value.back()))
+          return false;
+      }
+    } while (parser.consume(','));
+    return parser.consume(']');
+  } else if constexpr (metautils::is_string_v<T>) {
+    utils::use_memory_resource(value, parser.resource());
+    return parser.parse_string(value);
+  }
+  else if constexpr (::std::is_same_v<T, ::std::string_view>)
+    return parser.borrow_string(value);
+  else if constexpr (::std::is_same_v<T, char>) {
+    ::std::string storage;
+    ::std::string_view str;
+    if (!parser.parse_string(str, storage) || str.size() != 1)
+      return false;
+    value = str.front();
+    return true;
+  } else if constexpr (::std::is_same_v<T, bool>) {
+    if (parser.consume("true"))
+      return value = true;
+    value = false;
+    return parser.consume("false");
+  } else if constexpr (::std::is_enum_v<T>) {
+    if constexpr (info::is_reflected_enum_v<T>) {
+      if (!parser.skip_whitespace())
+        return false;
+      if (*parser.position() == '"') {
+        ::std::string storage;
+        ::std::string_view name;
+        if (!parser.parse_string(name, storage))
+          return false;
+        ::std::optional<T> result;
+        if constexpr (info::is_flags_enum_v<T>)
+          result = utils::flags_from_string<T>(name);
+        else
+          result = utils::enum_from_string<T>(name);
+        if (result)
+          value = *result;
+        return result.has_value();
+      }
+    }
+    ::std::underlying_type_t<T> number{};
+    if (!parser.parse_number(number))
+      return false;
+    value = static_cast<T>(number);
+    return true;
+  } else {
+    static_assert(::std::is_arithmetic_v<T>, "Type can't be deserialized");
+    if constexpr (::std::is_floating_point_v<T>)
+      if (parser.consume("null")) {
+        value = ::std::numeric_limits<T>::quiet_NaN();
+        return true;
+      }
+    return parser.parse_number(value);
+  }
+}
+} // namespace detail
+
+/**
+ * @brief Writes value as JSON and appends it to buffer, buffer can be reused
+ * between calls to avoid allocations
+ * @param value - reflected object (or std::vector, string, arithmetic value)
+ * @param buffer - output buffer
+ */
+template <class T> void write(const T &value, ::std::string &buffer) {
+  detail::write_value(buffer, value);
+}
+
+/**
+ * @brief Writes value as JSON
+ * @param value - reflected object (or std::vector, string, arithmetic value)
+ * @return std::string with JSON
+ */
+template <class T> ::std::string write(const T &value) {
+  ::std::string buffer;
+  write(value, buffer);
+  return buffer;
+}
+
+/**
+ * @brief Reads value from JSON, all input must be read
+ * @param input - JSON text
+ * @param value - output value, object variables missing in JSON are left as is
+ * @param resource - memory resource of std::pmr containers (nullptr -
+ * containers keep their allocators)
+ * @return false if JSON is invalid or doesn't match type of value
+ */
+template <class T>
+bool read(::std::string_view input, T &value,
+          ::std::pmr::memory_resource *resource = nullptr) {
+  detail::Parser parser(input, false, resource);
+  return detail::read_value(parser, value) && parser.at_end();
+}
+
+/**
+ * @brief Reads value from temporary string, borrowing types are forbidden,
+ * because their views would point into destroyed string
+ * @param input - JSON text
+ * @param value - output value, object variables missing in JSON are left as is
+ * @param resource - memory resource of std::pmr containers
+ * @return false if JSON is invalid or doesn't match type of value
+ */
+template <class T, class String,
+          ::std::enable_if_t<::std::is_same_v<String, ::std::string>, int> = 0>
+bool read(String &&input, T &value,
+          ::std::pmr::memory_resource *resource = nullptr) {
+  static_assert(!utils::is_borrowing_v<T>,
+                "Borrowing type can't be read from temporary string");
+  return read(::std::string_view(input), value, resource);
+}
+
+/**
+ * @brief Reads value from JSON in situ: borrowed strings with escape sequences
+ * are unescaped in place, so input is modified. Input must outlive value
+ * @param input - JSON text
+ * @param value - output value, object variables missing in JSON are left as is
+ * @param resource - memory resource of std::pmr containers
+ * @return false if JSON is invalid or doesn't match type of value
+ */
+template <class T>
+bool read_insitu(::std::string &input, T &value,
+                 ::std::pmr::memory_resource *resource = nullptr) {
+  detail::Parser parser(input, true, resource);
+  return detail::read_value(parser, value) && parser.at_end();
+}
+
+/**
+ * @brief Reads value from JSON, all input must be read
+ * @param input - JSON text
+ * @return std::optional with value or std::nullopt if JSON is invalid or
+ * doesn't match type T
+ */
+template <class T> ::std::optional<T> read(::std::string_view input) {
+  T value{};
+  if (!read(input, value))
+    return ::std::nullopt;
+  return value;
+}
+
+/**
+ * @brief Reads value from temporary string, borrowing types are forbidden,
+ * because their views would point into destroyed string
+ * @param input - JSON text
+ * @return std::optional with value or std::nullopt if JSON is invalid or
+ * doesn't match type T
+ */
+template <class T, class String,
+          ::std::enable_if_t<::std::is_same_v<String, ::std::string>, int> = 0>
+::std::optional<T> read(String &&input) {
+  static_assert(!utils::is_borrowing_v<T>,
+                "Borrowing type can't be read from temporary string");
+  return read<T>(::std::string_view(input));
+}
+} // namespace json
+} // namespace reflect
+
+#endif // REFLECT_JSON_HPP
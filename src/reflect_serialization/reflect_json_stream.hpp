@@ -0,0 +1,238 @@
+#ifndef REFLECT_JSON_STREAM_HPP
+#define REFLECT_JSON_STREAM_HPP
+
+#include "reflect_json.hpp"
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace reflect {
+
+namespace json {
+
+/**
+ * @brief Source of chunks which reads std::istream
+ */
+class StreamSource final {
+public:
+  /**
+   * @brief Constructor
+   * @param stream - input stream
+   */
+  explicit StreamSource(::std::istream &stream) noexcept : stream_(stream) {}
+
+  /**
+   * @brief Reads next chunk
+   * @param data - output buffer
+   * @param size - size of output buffer
+   * @return amount of read bytes, 0 if stream ends
+   */
+  ::std::size_t operator()(char *data, ::std::size_t size) {
+    stream_.read(data, static_cast<::std::streamsize>(size));
+    return static_cast<::std::size_t>(stream_.gcount());
+  }
+
+private:
+  ::std::istream &stream_; /**< Input stream */
+};
+
+/**
+ * @brief Pull reader of JSON array of T. Input is requested from Source by
+ * chunks, only current element is buffered, so memory doesn't depend on size
+ * of array. Source is callable std::size_t(char *data, std::size_t size), which
+ * returns amount of written bytes or 0 if input ends.
+ * Every element is reset to T{} before it is parsed, so object variables
+ * missing in element have default values, not values of previous element
+ */
+template <class T, class Source> class ArrayReader final {
+  static_assert(!utils::is_borrowing_v<T>,
+                "Borrowing types can't be read, buffer is reused");
+
+public:
+  /**
+   * @brief Constructor
+   * @param source - source of chunks
+   * @param chunk_size - initial size of buffer, buffer grows if element doesn't
+   * fit into it
+   */
+  explicit ArrayReader(Source source, ::std::size_t chunk_size = 1 << 16)
+      : source_(::std::move(source)), buffer_(chunk_size > 0 ? chunk_size : 1,
+                                             '\0') {}
+
+  /**
+   * @brief Reads next element
+   * @param value - output value
+   * @return false if array ends or input is invalid (see failed())
+   */
+  bool next(T &value) {
+    char c = 0;
+    if (state_ == State::Begin) {
+      if (!peek(c) || c != '[')
+        return fail();
+      ++begin_;
+      state_ = State::First;
+    }
+    if (state_ == State::End || state_ == State::Error)
+      return false;
+    if (!peek(c))
+      return fail();
+    if (c == ']') {
+      ++begin_;
+      state_ = State::End;
+      return false;
+    }
+    if (state_ == State::Next) {
+      if (c != ',')
+        return fail();
+      ++begin_;
+    }
+    ::std::size_t size = 0;
+    if (!element_size(size))
+      return fail();
+    detail::Parser parser(::std::string_view(buffer_.data() + begin_, size));
+    value = T{};
+    if (!detail::read_value(parser, value) || !parser.at_end())
+      return fail();
+    begin_ += size;
+    state_ = State::Next;
+    return true;
+  }
+
+  /**
+   * @brief Reads up to count next elements. Each element is reset before it is
+   * read (see next(T &))
+   * @param batch - output elements, resized to amount of read elements
+   * @param count - maximum amount of elements
+   * @return amount of read elements
+   */
+  ::std::size_t next(::std::vector<T> &batch, ::std::size_t count) {
+    if (batch.size() < count)
+      batch.resize(count);
+    ::std::size_t size = 0;
+    while (size < count && next(batch[size]))
+      ++size;
+    batch.resize(size);
+    return size;
+  }
+
+  /**
+   * @brief Checks if input is invalid
+   */
+  bool failed() const noexcept { return state_ == State::Error; }
+
+  /**
+   * @brief Checks if the whole array is read
+   */
+  bool finished() const noexcept { return state_ == State::End; }
+
+private:
+  /**
+   * @brief State of reader
+   */
+  enum class State {
+    Begin, /**< Before '[' */
+    First, /**< Before first element */
+    Next,  /**< Before ',' or ']' */
+    End,   /**< After ']' */
+    Error  /**< Input is invalid */
+  };
+
+  /**
+   * @brief Moves unread bytes to beginning of buffer and reads next chunk,
+   * buffer is doubled if it's full
+   * @return false if source ends
+   */
+  bool refill() {
+    if (begin_ > 0) {
+      ::std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+      end_ -= begin_;
+      begin_ = 0;
+    }
+    if (end_ == buffer_.size())
+      buffer_.resize(buffer_.size() * 2);
+    ::std::size_t size = source_(buffer_.data() + end_, buffer_.size() - end_);
+    end_ += size;
+    eof_ = size == 0;
+    return !eof_;
+  }
+
+  /**
+   * @brief Skips whitespaces and gets next char
+   * @param c - output char
+   * @return false if input ends
+   */
+  bool peek(char &c) {
+    for (;;) {
+      while (begin_ != end_ &&
+             (buffer_[begin_] == ' ' || buffer_[begin_] == '\n' ||
+              buffer_[begin_] == '\r' || buffer_[begin_] == '\t'))
+        ++begin_;
+      if (begin_ != end_) {
+        c = buffer_[begin_];
+        return true;
+      }
+      if (eof_ || !refill())
+        return false;
+    }
+  }
+
+  /**
+   * @brief Finds size of next element, reads chunks until the whole element
+   * is in buffer (scalar elements also need next char to be read)
+   * @param size - output size
+   * @return false if element is invalid
+   */
+  bool element_size(::std::size_t &size) {
+    for (;;) {
+      const char *begin = buffer_.data() + begin_;
+      const char *end = buffer_.data() + end_;
+      detail::Parser parser(
+          ::std::string_view(begin, static_cast<::std::size_t>(end - begin)));
+      bool skipped = parser.skip_value();
+      if (skipped && (parser.position() != end || eof_)) {
+        size = static_cast<::std::size_t>(parser.position() - begin);
+        return true;
+      }
+      if ((!skipped && parser.position() != end) || eof_ || !refill())
+        return false;
+    }
+  }
+
+  /**
+   * @brief Switches reader to error state
+   * @return false
+   */
+  bool fail() {
+    state_ = State::Error;
+    return false;
+  }
+
+  Source source_;             /**< Source of chunks */
+  ::std::string buffer_;      /**< Buffered input */
+  ::std::size_t begin_{0};    /**< First unread byte of buffer */
+  ::std::size_t end_{0};      /**< End of read bytes of buffer */
+  bool eof_{false};           /**< Source ends */
+  State state_{State::Begin}; /**< State of reader */
+};
+
+/**
+ * @brief Creates pull reader of JSON array of T
+ * @param source - source of chunks, callable std::size_t(char *data,
+ * std::size_t size)
+ * @param chunk_size - initial size of buffer
+ * @return ArrayReader
+ */
+template <class T, class Source>
+ArrayReader<T, ::std::decay_t<Source>>
+array_reader(Source &&source, ::std::size_t chunk_size = 1 << 16) {
+  return ArrayReader<T, ::std::decay_t<Source>>(
+      ::std::forward<Source>(source), chunk_size);
+}
+} // namespace json
+} // namespace reflect
+
+#endif // REFLECT_JSON_STREAM_HPP
@@ -0,0 +1,338 @@
+#ifndef REFLECT_COMPARE_HPP
+#define REFLECT_COMPARE_HPP
+
+#include "../meta_utils/meta_utils.hpp"
+#include "../reflect_information/reflect_information.hpp"
+#include "reflect_invokes.hpp"
+#include "reflect_metadata.hpp"
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace reflect {
+
+namespace utils {
+
+template <class T> struct hash;
+template <class T> struct equal;
+template <class T> struct compare;
+
+namespace detail {
+
+using ObjVars = info::ObjectIndexGenerator<info::VariableIndexGenerator<
+    info::DefaultIndexGenerator>>; /**< Object variables */
+
+template <class T, long long I>
+using obj_var_t = info::item_value_t<selected_item_t<
+    T, ObjVars, ::boost::hana::llong<I>>>; /**< Type of object variable I */
+
+template <class T> constexpr bool is_bytes_comparable_impl();
+
+/**
+ * @brief Checks if value of V is equal to its bytes: integral, enum, pointer
+ * or reflected class which object variables cover whole object
+ */
+template <class V> constexpr bool is_bytes_value_impl() {
+  if constexpr (info::is_reflected_v<V>)
+    return is_bytes_comparable_impl<V>();
+  else
+    return ::std::is_integral_v<V> || ::std::is_enum_v<V> ||
+           ::std::is_pointer_v<V>;
+}
+
+/**
+ * @brief Checks if all object variables are compared as bytes and their total
+ * size is size of T
+ * @param std::index_sequence<Positions...> - positions of object variables
+ */
+template <class T, ::std::size_t... Positions>
+constexpr bool is_bytes_covered_impl(::std::index_sequence<Positions...> &&) {
+  return (true && ... && is_bytes_value_impl<obj_var_t<T, Positions>>()) &&
+         (::std::size_t{0} + ... + sizeof(obj_var_t<T, Positions>)) ==
+             sizeof(T);
+}
+
+/**
+ * @brief Checks if T can be compared and hashed as bytes
+ */
+template <class T> constexpr bool is_bytes_comparable_impl() {
+  if constexpr (::std::has_unique_object_representations_v<T>)
+    return is_bytes_covered_impl<T>(
+        ::std::make_index_sequence<selected_count_v<T, ObjVars>>());
+  else
+    return false;
+}
+
+/**
+ * @brief Checks if bytes of V are ordered as its value: bool, unsigned char or
+ * enum with underlying unsigned char
+ */
+template <class V> constexpr bool is_byte_ordered_impl() {
+  if constexpr (::std::is_enum_v<V>)
+    return is_byte_ordered_impl<::std::underlying_type_t<V>>();
+  else
+    return ::std::is_integral_v<V> && ::std::is_unsigned_v<V> &&
+           sizeof(V) == 1;
+}
+
+/**
+ * @brief Checks if all object variables are ordered as their bytes
+ * @param std::index_sequence<Positions...> - positions of object variables
+ */
+template <class T, ::std::size_t... Positions>
+constexpr bool is_byte_ordered_all(::std::index_sequence<Positions...> &&) {
+  return (true && ... && is_byte_ordered_impl<obj_var_t<T, Positions>>());
+}
+
+/**
+ * @brief Checks if object variables are placed in memory in reflection order
+ * one after another (it's known at compile time, so check is folded by
+ * compiler)
+ * @param obj - object
+ * @param std::index_sequence<Positions...> - positions of object variables
+ * (without the last one)
+ */
+template <class T, ::std::size_t... Positions>
+bool is_memory_ordered(const T &obj, ::std::index_sequence<Positions...> &&) {
+  return (true && ... &&
+          (reinterpret_cast<const unsigned char *>(
+               ::std::addressof(utils::invoke<T, ObjVars>(
+                   ::boost::hana::llong_c<Positions + 1>, obj))) ==
+           reinterpret_cast<const unsigned char *>(
+               ::std::addressof(utils::invoke<T, ObjVars>(
+                   ::boost::hana::llong_c<Positions>, obj))) +
+               sizeof(obj_var_t<T, Positions>)));
+}
+
+/**
+ * @brief SFINAE check if type has three-way compare method (e.g. std::string)
+ */
+constexpr auto has_compare = ::boost::hana::is_valid(
+    [](auto &&value)
+        -> decltype(static_cast<int>(value.compare(value))) {});
+
+/**
+ * @brief Hash of value: reflected class, std::vector or type with std::hash
+ */
+template <class V> ::std::size_t hash_value(const V &value) {
+  if constexpr (info::is_reflected_v<V>)
+    return hash<V>{}(value);
+  else if constexpr (metautils::is_vector_v<V>) {
+    unsigned long long result = value.size();
+    for (const auto &item : value)
+      result = metautils::detail::mix_hash(hash_value(item), result);
+    return static_cast<::std::size_t>(result);
+  } else
+    return ::std::hash<V>{}(value);
+}
+
+/**
+ * @brief Checks if values are equal: reflected class, std::vector or type
+ * with operator ==
+ */
+template <class V> bool equal_value(const V &left, const V &right) {
+  if constexpr (info::is_reflected_v<V>)
+    return equal<V>{}(left, right);
+  else if constexpr (metautils::is_vector_v<V>) {
+    if (left.size() != right.size())
+      return false;
+    for (::std::size_t i = 0; i < left.size(); ++i)
+      if (!equal_value(left[i], right[i]))
+        return false;
+    return true;
+  } else
+    return left == right;
+}
+
+/**
+ * @brief Three-way comparison of values: reflected class, std::vector
+ * (lexicographical), type with compare method (std::string) or type with
+ * operator <
+ * @return negative if left < right, 0 if values are equivalent, positive if
+ * left > right
+ */
+template <class V> int compare_value(const V &left, const V &right) {
+  if constexpr (info::is_reflected_v<V>)
+    return compare<V>{}(left, right);
+  else if constexpr (metautils::is_vector_v<V>) {
+    const ::std::size_t size =
+        left.size() < right.size() ? left.size() : right.size();
+    for (::std::size_t i = 0; i < size; ++i)
+      if (const int result = compare_value(left[i], right[i]))
+        return result;
+    return (left.size() > right.size()) - (left.size() < right.size());
+  } else if constexpr (decltype(has_compare(left))::value) {
+    const int result = left.compare(right);
+    return (result > 0) - (result < 0);
+  } else
+    return (right < left) - (left < right);
+}
+
+/**
+ * @brief Combines hashes of object variables in reflection order
+ * @param std::index_sequence<Positions...> - positions of object variables
+ */
+template <class T, ::std::size_t... Positions>
+::std::size_t hash_object(const T &obj,
+                          ::std::index_sequence<Positions...> &&) {
+  unsigned long long result = 0;
+  ((result = metautils::detail::mix_hash(
+        hash_value(utils::invoke<T, ObjVars>(
+            ::boost::hana::llong_c<Positions>, obj)),
+        result)),
+   ...);
+  return static_cast<::std::size_t>(result);
+}
+
+/**
+ * @brief Checks if all object variables are equal
+ * @param std::index_sequence<Positions...> - positions of object variables
+ */
+template <class T, ::std::size_t... Positions>
+bool equal_object(const T &left, const T &right,
+                  ::std::index_sequence<Positions...> &&) {
+  return (true && ... &&
+          equal_value(
+              utils::invoke<T, ObjVars>(::boost::hana::llong_c<Positions>,
+                                        left),
+              utils::invoke<T, ObjVars>(::boost::hana::llong_c<Positions>,
+                                        right)));
+}
+
+/**
+ * @brief Compares object variables in reflection order until first not
+ * equivalent one
+ * @param std::index_sequence<Positions...> - positions of object variables
+ */
+template <class T, ::std::size_t... Positions>
+int compare_object(const T &left, const T &right,
+                   ::std::index_sequence<Positions...> &&) {
+  int result = 0;
+  (void)(true && ... &&
+         ((result = compare_value(
+               utils::invoke<T, ObjVars>(::boost::hana::llong_c<Positions>,
+                                         left),
+               utils::invoke<T, ObjVars>(::boost::hana::llong_c<Positions>,
+                                         right))) == 0));
+  return result;
+}
+} // namespace detail
+
+/**
+ * @brief Checks if object variables of T (including inherited ones) cover
+ * whole object without padding and every variable is equal to its bytes
+ * (integral, enum, pointer or such reflected class), so objects are compared
+ * by one memcmp and hashed as bytes
+ */
+template <class T>
+struct is_bytes_comparable
+    : ::std::bool_constant<
+          detail::is_bytes_comparable_impl<::std::decay_t<T>>()> {};
+
+template <class T>
+constexpr bool is_bytes_comparable_v =
+    is_bytes_comparable<T>::value; /**< Helper variable template for
+                                      is_bytes_comparable */
+
+/**
+ * @brief Hash of reflected object, combined from hashes of object variables
+ * (including inherited ones) or computed over bytes of object if
+ * is_bytes_comparable_v<T>
+ */
+template <class T> struct hash {
+  /**
+   * @brief Hash of object
+   * @param obj - object
+   */
+  ::std::size_t operator()(const T &obj) const {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+    static_assert(info::is_reflected_v<T>, "Class must be reflected");
+#endif
+    if constexpr (is_bytes_comparable_v<T>)
+      return static_cast<::std::size_t>(
+          metautils::bytes_hash(::std::addressof(obj), sizeof(T)));
+    else
+      return detail::hash_object(
+          obj,
+          ::std::make_index_sequence<selected_count_v<T, detail::ObjVars>>());
+  }
+};
+
+/**
+ * @brief Checks if all object variables (including inherited ones) of
+ * reflected objects are equal, objects are compared by one memcmp if
+ * is_bytes_comparable_v<T>
+ */
+template <class T> struct equal {
+  /**
+   * @brief Checks if objects are equal
+   * @param left - first object
+   * @param right - second object
+   */
+  bool operator()(const T &left, const T &right) const {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+    static_assert(info::is_reflected_v<T>, "Class must be reflected");
+#endif
+    if constexpr (is_bytes_comparable_v<T>)
+      return ::std::memcmp(::std::addressof(left), ::std::addressof(right),
+                           sizeof(T)) == 0;
+    else
+      return detail::equal_object(
+          left, right,
+          ::std::make_index_sequence<selected_count_v<T, detail::ObjVars>>());
+  }
+};
+
+/**
+ * @brief Lexicographical three-way comparison of object variables (including
+ * inherited ones) of reflected objects in reflection order. Objects are
+ * compared by one memcmp if is_bytes_comparable_v<T>, all variables are
+ * bytes (unsigned char, bool or enum of unsigned char) and they are placed in
+ * memory in reflection order
+ */
+template <class T> struct compare {
+  /**
+   * @brief Compares objects
+   * @param left - first object
+   * @param right - second object
+   * @return negative if left < right, 0 if objects are equivalent, positive
+   * if left > right
+   */
+  int operator()(const T &left, const T &right) const {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+    static_assert(info::is_reflected_v<T>, "Class must be reflected");
+#endif
+    constexpr ::std::size_t count = selected_count_v<T, detail::ObjVars>;
+    if constexpr (is_bytes_comparable_v<T> && count > 0 &&
+                  detail::is_byte_ordered_all<T>(
+                      ::std::make_index_sequence<count>()))
+      if (detail::is_memory_ordered(left,
+                                    ::std::make_index_sequence<count - 1>()))
+        return ::std::memcmp(::std::addressof(left), ::std::addressof(right),
+                             sizeof(T));
+    return detail::compare_object(left, right,
+                                  ::std::make_index_sequence<count>());
+  }
+};
+
+/**
+ * @brief Strict weak ordering of reflected objects by compare (e.g. for
+ * std::map)
+ */
+template <class T> struct less {
+  /**
+   * @brief Checks if left is less than right
+   * @param left - first object
+   * @param right - second object
+   */
+  bool operator()(const T &left, const T &right) const {
+    return compare<T>{}(left, right) < 0;
+  }
+};
+} // namespace utils
+} // namespace reflect
+
+#endif // REFLECT_COMPARE_HPP
@@ -0,0 +1,298 @@
+#ifndef REFLECT_DIFF_HPP
+#define REFLECT_DIFF_HPP
+
+#include "../meta_utils/meta_utils.hpp"
+#include "../reflect_information/reflect_information.hpp"
+#include "reflect_compare.hpp"
+#include "reflect_invokes.hpp"
+#include "reflect_metadata.hpp"
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace reflect {
+
+namespace utils {
+
+/**
+ * @brief Bitmask of N members, bit i is member at position i. Bits are stored
+ * in 64-bit words, bits after N are always zero
+ */
+template <::std::size_t N> class member_mask final {
+public:
+  static constexpr ::std::size_t word_bits = 64; /**< Bits in word */
+  static constexpr ::std::size_t words_count =
+      (N + word_bits - 1) / word_bits; /**< Amount of words */
+
+  using words_type =
+      ::std::array<::std::uint64_t, words_count>; /**< Words of mask */
+
+  /**
+   * @brief Amount of members
+   */
+  static constexpr ::std::size_t size() noexcept { return N; }
+
+  /**
+   * @brief Checks bit of member
+   * @param position - position of member
+   */
+  constexpr bool test(::std::size_t position) const noexcept {
+    return (words_[position / word_bits] >> (position % word_bits)) & 1u;
+  }
+
+  /**
+   * @brief Sets bit of member
+   * @param position - position of member
+   * @param value - value of bit
+   */
+  constexpr void set(::std::size_t position, bool value = true) noexcept {
+    ::std::uint64_t &word = words_[position / word_bits];
+    word = (word & ~(::std::uint64_t{1} << (position % word_bits))) |
+           (::std::uint64_t{value} << (position % word_bits));
+  }
+
+  /**
+   * @brief Clears all bits
+   */
+  constexpr void reset() noexcept {
+    for (auto &word : words_)
+      word = 0;
+  }
+
+  /**
+   * @brief Amount of set bits
+   */
+  ::std::size_t count() const noexcept {
+    ::std::size_t result = 0;
+    for (auto word : words_)
+      result += ::std::bitset<word_bits>(word).count();
+    return result;
+  }
+
+  /**
+   * @brief Checks if any bit is set
+   */
+  constexpr bool any() const noexcept {
+    ::std::uint64_t result = 0;
+    for (auto word : words_)
+      result |= word;
+    return result != 0;
+  }
+
+  /**
+   * @brief Words of mask
+   */
+  constexpr words_type &words() noexcept { return words_; }
+
+  /**
+   * @brief Words of mask
+   */
+  constexpr const words_type &words() const noexcept { return words_; }
+
+  /**
+   * @brief Checks if masks are equal
+   */
+  friend constexpr bool operator==(const member_mask &left,
+                                   const member_mask &right) noexcept {
+    for (::std::size_t i = 0; i < words_count; ++i)
+      if (left.words_[i] != right.words_[i])
+        return false;
+    return true;
+  }
+
+  /**
+   * @brief Checks if masks aren't equal
+   */
+  friend constexpr bool operator!=(const member_mask &left,
+                                   const member_mask &right) noexcept {
+    return !(left == right);
+  }
+
+private:
+  words_type words_{}; /**< Words of mask */
+};
+
+template <class T>
+using member_mask_t = member_mask<static_cast<::std::size_t>(
+    selected_count_v<T, detail::ObjVars>)>; /**< Mask of object variables of T
+                                               (including inherited ones) */
+
+namespace detail {
+
+/**
+ * @brief Checks if value of V is compared by is_changed as bytes
+ */
+template <class V> constexpr bool is_diff_bytes_value() {
+  return is_bytes_value_impl<V>() || ::std::is_same_v<V, float> ||
+         ::std::is_same_v<V, double>;
+}
+
+/**
+ * @brief Checks if all object variables are compared as bytes and their total
+ * size is size of T
+ * @param std::index_sequence<Positions...> - positions of object variables
+ */
+template <class T, ::std::size_t... Positions>
+constexpr bool is_diff_bytes_impl(::std::index_sequence<Positions...> &&) {
+  return (true && ... && is_diff_bytes_value<obj_var_t<T, Positions>>()) &&
+         (::std::size_t{0} + ... + sizeof(obj_var_t<T, Positions>)) ==
+             sizeof(T);
+}
+
+/**
+ * @brief Checks if object variables of trivially copyable T cover whole
+ * object and are compared as bytes, so equal objects can be found by one
+ * memcmp
+ */
+template <class T> constexpr bool is_diff_bytes() {
+  if constexpr (::std::is_trivially_copyable_v<T>)
+    return is_diff_bytes_impl<T>(
+        ::std::make_index_sequence<selected_count_v<T, ObjVars>>());
+  else
+    return false;
+}
+
+/**
+ * @brief Checks if values are different: values which are equal to their bytes
+ * (and float, double) are compared as bytes, others by equal_value
+ */
+template <class V> bool is_changed(const V &left, const V &right) {
+  if constexpr (is_diff_bytes_value<V>())
+    return ::std::memcmp(::std::addressof(left), ::std::addressof(right),
+                         sizeof(V)) != 0;
+  else
+    return !equal_value(left, right);
+}
+
+/**
+ * @brief Sets bits of changed object variables, bits are or-ed to words
+ * without branches
+ * @param std::index_sequence<Positions...> - positions of object variables
+ */
+template <class T, class Mask, ::std::size_t... Positions>
+void diff_object(Mask &mask, const T &left, const T &right,
+                 ::std::index_sequence<Positions...> &&) {
+  // words are accumulated in local copy, so they are kept in registers
+  typename Mask::words_type words{};
+  ((words[Positions / Mask::word_bits] |=
+    ::std::uint64_t{is_changed(
+        utils::invoke<T, ObjVars>(::boost::hana::llong_c<Positions>, left),
+        utils::invoke<T, ObjVars>(::boost::hana::llong_c<Positions>, right))}
+    << (Positions % Mask::word_bits)),
+   ...);
+  mask.words() = words;
+}
+
+/**
+ * @brief Copies object variables which bits are set
+ * @param std::index_sequence<Positions...> - positions of object variables
+ */
+template <class T, class Mask, ::std::size_t... Positions>
+void patch_object(T &obj, const Mask &mask, const T &source,
+                  ::std::index_sequence<Positions...> &&) {
+  ((mask.test(Positions)
+        ? void(utils::invoke<T, ObjVars>(::boost::hana::llong_c<Positions>,
+                                         obj) =
+                   utils::invoke<T, ObjVars>(
+                       ::boost::hana::llong_c<Positions>, source))
+        : void()),
+   ...);
+}
+} // namespace detail
+
+/**
+ * @brief Checks if at least 1/8 of bits are set. Dense masks are processed by
+ * checking every bit inline, sparse ones by visit_masked
+ * @param mask - mask
+ */
+template <::std::size_t N>
+bool is_dense(const member_mask<N> &mask) noexcept {
+  return mask.count() * 8 > N;
+}
+
+/**
+ * @brief Visits elements which bits are set in mask in order of positions.
+ * Only set bits are visited, visitor is called through visit_member jump
+ * table with compile-time index (boost::hana::llong) and obj
+ * @param obj - object passed to visitor
+ * @param mask - mask of elements selected by the generator
+ * @param visitor - visitor, returns false to stop visiting
+ * @return false if visitor returned false
+ */
+template <class T, class Generator = info::DefaultIndexGenerator, class Obj,
+          ::std::size_t N, class Visitor>
+bool visit_masked(Obj &&obj, const member_mask<N> &mask, Visitor &&visitor) {
+  using Mask = member_mask<N>;
+  if constexpr (N > 0)
+    for (::std::size_t i = 0; i < Mask::words_count; ++i)
+      for (::std::uint64_t word = mask.words()[i]; word != 0;
+           word &= word - 1)
+        if (!visit_member<T, Generator>(
+                obj,
+                i * Mask::word_bits + ::std::bitset<Mask::word_bits>(
+                                          (word & (~word + 1)) - 1)
+                                          .count(),
+                visitor))
+          return false;
+  return true;
+}
+
+/**
+ * @brief Finds object variables (including inherited ones) which differ.
+ * Integral, enum, pointer, float and double variables are compared as bytes.
+ * If such variables cover whole object, objects are compared by one memcmp
+ * first, so equal objects are detected without visiting variables
+ * @param left - first object
+ * @param right - second object
+ * @return member_mask_t<T>, bit i is set if object variable at position i
+ * (in ObjVars order) differs
+ */
+template <class T>
+member_mask_t<T> diff(const T &left, const T &right) {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+  static_assert(info::is_reflected_v<T>, "Class must be reflected");
+#endif
+  member_mask_t<T> mask;
+  if constexpr (detail::is_diff_bytes<T>())
+    if (::std::memcmp(::std::addressof(left), ::std::addressof(right),
+                      sizeof(T)) == 0)
+      return mask;
+  detail::diff_object(
+      mask, left, right,
+      ::std::make_index_sequence<member_mask_t<T>::size()>());
+  return mask;
+}
+
+/**
+ * @brief Copies object variables which bits are set in mask from source
+ * (e.g. result of diff)
+ * @param obj - patched object
+ * @param mask - mask of object variables
+ * @param source - object with new values
+ */
+template <class T>
+void apply_patch(T &obj, const member_mask_t<T> &mask, const T &source) {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+  static_assert(info::is_reflected_v<T>, "Class must be reflected");
+#endif
+  using Mask = member_mask_t<T>;
+  if (is_dense(mask))
+    detail::patch_object(obj, mask, source,
+                         ::std::make_index_sequence<Mask::size()>());
+  else
+    visit_masked<T, detail::ObjVars>(
+        obj, mask, [&source](auto index, T &target) {
+          utils::invoke<T, detail::ObjVars>(index, target) =
+              utils::invoke<T, detail::ObjVars>(index, source);
+          return true;
+        });
+}
+} // namespace utils
+} // namespace reflect
+
+#endif // REFLECT_DIFF_HPP
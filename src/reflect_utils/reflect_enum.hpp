@@ -0,0 +1,345 @@
+#ifndef REFLECT_ENUM_HPP
+#define REFLECT_ENUM_HPP
+
+#include "../meta_utils/meta_utils.hpp"
+#include "../reflect_information/reflect_information.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace reflect {
+
+namespace utils {
+
+namespace detail {
+
+/**
+ * @brief Key of enum value: underlying value converted to unsigned long long,
+ * difference of keys is distance between values
+ */
+template <class E> constexpr unsigned long long enum_key(E value) noexcept {
+  return static_cast<unsigned long long>(
+      static_cast<::std::underlying_type_t<E>>(value));
+}
+
+/**
+ * @brief Minimal enumerator of E
+ * @return key of enumerator (0 if there are no enumerators)
+ */
+template <class E> constexpr unsigned long long enum_min() {
+  constexpr auto &values = info::EnumInfo<E>::values;
+  if constexpr (values.size() == 0)
+    return 0;
+  else {
+    auto result = values[0];
+    for (auto value : values)
+      result = value < result ? value : result;
+    return enum_key(result);
+  }
+}
+
+/**
+ * @brief Distance between minimal and maximal enumerator of E
+ */
+template <class E> constexpr unsigned long long enum_span() {
+  constexpr auto &values = info::EnumInfo<E>::values;
+  unsigned long long result = 0;
+  for (auto value : values)
+    result = enum_key(value) - enum_min<E>() > result
+                 ? enum_key(value) - enum_min<E>()
+                 : result;
+  return result;
+}
+
+/**
+ * @brief Enumerator of sorted table
+ */
+struct enum_entry {
+  unsigned long long key; /**< Distance from minimal enumerator */
+  ::std::uint32_t index;  /**< Index of enumerator */
+};
+
+/**
+ * @brief Hash of name from its length and first, middle and last chars, cost
+ * doesn't depend on length of name
+ */
+constexpr unsigned long long sampled_hash(::std::string_view str) noexcept {
+  if (str.empty())
+    return 0;
+  return static_cast<unsigned long long>(str.size()) |
+         static_cast<unsigned long long>(static_cast<unsigned char>(str[0]))
+             << 16 |
+         static_cast<unsigned long long>(
+             static_cast<unsigned char>(str[str.size() / 2]))
+             << 24 |
+         static_cast<unsigned long long>(
+             static_cast<unsigned char>(str[str.size() - 1]))
+             << 32;
+}
+
+/**
+ * @brief Checks if sampled hashes of names are distinct
+ */
+template <::std::size_t N>
+constexpr bool is_sampled_unique(
+    const ::std::array<::std::string_view, N> &names) {
+  for (::std::size_t i = 0; i < N; ++i)
+    for (::std::size_t j = 0; j < i; ++j)
+      if (sampled_hash(names[i]) == sampled_hash(names[j]))
+        return false;
+  return true;
+}
+
+/**
+ * @brief Compile-time tables of enum E. Value is mapped to name by dense table
+ * indexed by distance from minimal enumerator if at least half of values in
+ * range have names, otherwise by binary search in table sorted by value. Name
+ * is mapped to value by perfect hash of sampled_hash of names (or of
+ * metautils::string_hash if sampled hashes of some names are equal)
+ */
+template <class E> struct enum_data {
+  using Info = info::EnumInfo<E>; /**< Enumerators */
+
+  static constexpr ::std::size_t size =
+      Info::values.size(); /**< Amount of enumerators */
+  static constexpr unsigned long long min = enum_min<E>(); /**< Minimal key */
+  static constexpr bool dense =
+      size > 0 && enum_span<E>() < 2 * size; /**< Dense table is used */
+  static constexpr bool sampled =
+      is_sampled_unique(Info::names); /**< sampled_hash is used */
+
+  /**
+   * @brief Hash of name
+   */
+  static constexpr unsigned long long name_hash(::std::string_view str) {
+    if constexpr (sampled)
+      return sampled_hash(str);
+    else
+      return metautils::string_hash(str);
+  }
+
+  /**
+   * @brief Dense table, enumerators with equal values have name of the first
+   * one, values without name have empty name
+   */
+  static constexpr decltype(auto) make_dense() {
+    ::std::array<::std::string_view,
+                 dense ? static_cast<::std::size_t>(enum_span<E>()) + 1 : 0>
+        result{};
+    for (::std::size_t i = size; i-- > 0;)
+      if constexpr (dense)
+        result[enum_key(Info::values[i]) - min] = Info::names[i];
+    return result;
+  }
+
+  /**
+   * @brief Table sorted by value (insertion sort, so enumerators with equal
+   * values are ordered by index)
+   */
+  static constexpr decltype(auto) make_sorted() {
+    ::std::array<enum_entry, dense ? 0 : size> result{};
+    if constexpr (!dense)
+      for (::std::size_t i = 0; i < size; ++i) {
+        enum_entry entry{enum_key(Info::values[i]) - min,
+                         static_cast<::std::uint32_t>(i)};
+        ::std::size_t j = i;
+        for (; j > 0 && entry.key < result[j - 1].key; --j)
+          result[j] = result[j - 1];
+        result[j] = entry;
+      }
+    return result;
+  }
+
+  /**
+   * @brief Hashes of names
+   */
+  static constexpr decltype(auto) make_hashes() {
+    ::std::array<unsigned long long, size> result{};
+    for (::std::size_t i = 0; i < size; ++i)
+      result[i] = name_hash(Info::names[i]);
+    return result;
+  }
+
+  static constexpr auto dense_names{make_dense()}; /**< Dense table */
+  static constexpr auto sorted{make_sorted()};     /**< Sorted table */
+  static constexpr metautils::perfect_hash<size> hash{
+      make_hashes()}; /**< Perfect hash of names */
+};
+
+/**
+ * @brief Underlying value of flag set as unsigned integer
+ */
+template <class E>
+constexpr ::std::make_unsigned_t<::std::underlying_type_t<E>>
+flags_bits(E value) noexcept {
+  return static_cast<::std::make_unsigned_t<::std::underlying_type_t<E>>>(
+      value);
+}
+
+/**
+ * @brief Removes spaces around name
+ */
+constexpr ::std::string_view trim_spaces(::std::string_view str) noexcept {
+  while (!str.empty() && str.front() == ' ')
+    str.remove_prefix(1);
+  while (!str.empty() && str.back() == ' ')
+    str.remove_suffix(1);
+  return str;
+}
+} // namespace detail
+
+/**
+ * @brief Names of enumerators of reflected enum in reflection order
+ * @return const std::array of std::string_view
+ */
+template <class E> constexpr decltype(auto) enum_names() noexcept {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+  static_assert(info::is_reflected_enum_v<E>, "Enum must be reflected");
+#endif
+  return (info::EnumInfo<E>::names);
+}
+
+/**
+ * @brief Enumerators of reflected enum in reflection order
+ * @return const std::array of E
+ */
+template <class E> constexpr decltype(auto) enum_values() noexcept {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+  static_assert(info::is_reflected_enum_v<E>, "Enum must be reflected");
+#endif
+  return (info::EnumInfo<E>::values);
+}
+
+/**
+ * @brief Name of enum value: one read of dense table or binary search in
+ * sorted table (see detail::enum_data)
+ * @param value - value of reflected enum
+ * @return name of the first enumerator with such value or empty
+ * std::string_view if value has no name
+ */
+template <class E> constexpr ::std::string_view enum_to_string(E value) {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+  static_assert(info::is_reflected_enum_v<E>, "Enum must be reflected");
+#endif
+  using Data = detail::enum_data<E>;
+  const unsigned long long key = detail::enum_key(value) - Data::min;
+  if constexpr (Data::dense)
+    return key < Data::dense_names.size() ? Data::dense_names[key]
+                                          : ::std::string_view();
+  else {
+    ::std::size_t first = 0;
+    ::std::size_t last = Data::sorted.size();
+    while (first < last) {
+      const ::std::size_t middle = first + (last - first) / 2;
+      if (Data::sorted[middle].key < key)
+        first = middle + 1;
+      else
+        last = middle;
+    }
+    return first < Data::sorted.size() && Data::sorted[first].key == key
+               ? info::EnumInfo<E>::names[Data::sorted[first].index]
+               : ::std::string_view();
+  }
+}
+
+/**
+ * @brief Value of enumerator by name, name is found by perfect hash (see
+ * detail::enum_data)
+ * @param str - name of enumerator
+ * @return std::optional with value or std::nullopt if there is no such
+ * enumerator
+ */
+template <class E>
+constexpr ::std::optional<E> enum_from_string(::std::string_view str) {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+  static_assert(info::is_reflected_enum_v<E>, "Enum must be reflected");
+#endif
+  using Data = detail::enum_data<E>;
+  const ::std::uint32_t index = Data::hash.find(Data::name_hash(str));
+  if (index != Data::hash.npos && info::EnumInfo<E>::names[index] == str)
+    return info::EnumInfo<E>::values[index];
+  return ::std::nullopt;
+}
+
+/**
+ * @brief Appends names of flags of value separated by '|'. Enumerators are
+ * checked in reflection order, enumerator is written if all its bits are set
+ * in value and some of them aren't written yet. Zero value is written as name
+ * of zero enumerator (or nothing)
+ * @param value - value of reflected flag set
+ * @param buffer - output buffer
+ * @return false if some bits have no name (buffer isn't changed)
+ */
+template <class E> bool flags_to_string(E value, ::std::string &buffer) {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+  static_assert(info::is_reflected_enum_v<E>, "Enum must be reflected");
+#endif
+  const auto bits = detail::flags_bits(value);
+  if (bits == 0) {
+    buffer.append(enum_to_string(value));
+    return true;
+  }
+  const ::std::size_t size = buffer.size();
+  auto remaining = bits;
+  for (::std::size_t i = 0; i < info::EnumInfo<E>::values.size(); ++i) {
+    const auto flag = detail::flags_bits(info::EnumInfo<E>::values[i]);
+    if (flag != 0 && (bits & flag) == flag && (remaining & flag) != 0) {
+      if (remaining != bits)
+        buffer.push_back('|');
+      buffer.append(info::EnumInfo<E>::names[i]);
+      remaining &= ~flag;
+    }
+  }
+  if (remaining != 0)
+    buffer.resize(size);
+  return remaining == 0;
+}
+
+/**
+ * @brief Names of flags of value separated by '|'
+ * @param value - value of reflected flag set
+ * @return std::optional with names or std::nullopt if some bits have no name
+ */
+template <class E>
+::std::optional<::std::string> flags_to_string(E value) {
+  ::std::string result;
+  if (!flags_to_string(value, result))
+    return ::std::nullopt;
+  return result;
+}
+
+/**
+ * @brief Value of flag set by names of flags separated by '|' (spaces around
+ * names are ignored)
+ * @param str - names of flags, empty string is zero value
+ * @return std::optional with value or std::nullopt if some name is unknown
+ */
+template <class E>
+constexpr ::std::optional<E> flags_from_string(::std::string_view str) {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+  static_assert(info::is_reflected_enum_v<E>, "Enum must be reflected");
+#endif
+  using Bits = decltype(detail::flags_bits(E{}));
+  Bits bits = 0;
+  if (detail::trim_spaces(str).empty())
+    return E{};
+  for (;;) {
+    const ::std::size_t separator = str.find('|');
+    const auto flag =
+        enum_from_string<E>(detail::trim_spaces(str.substr(0, separator)));
+    if (!flag)
+      return ::std::nullopt;
+    bits |= detail::flags_bits(*flag);
+    if (separator == str.npos)
+      return static_cast<E>(bits);
+    str.remove_prefix(separator + 1);
+  }
+}
+} // namespace utils
+} // namespace reflect
+
+#endif // REFLECT_ENUM_HPP
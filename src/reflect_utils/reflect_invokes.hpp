@@ -14,33 +14,76 @@ template <class T>
 using MetaClass = info::MetaClass<typename ::std::decay_t<
     T>::MetaInfo_type>; /**< Helper type template to specify Metadata class */
 
+template <class T, class Generator, class I, class... Args>
+constexpr decltype(auto) invoke(I &&index, Args &&... args) noexcept(
+    detail::is_nothrow_invoke_impl<selected_item_t<T, Generator, I>,
+                                   Args &&...>());
+
 template <class T, class Generator = info::DefaultIndexGenerator, class I,
           class... Args>
-constexpr decltype(auto) get(I &&, Args &&...);
+constexpr decltype(auto) get(I &&, Args &&...) noexcept(
+    noexcept(invoke<T, Generator>(::std::declval<I>(),
+                                  ::std::declval<Args>()...)));
 
 template <class T, class Generator, class I, class SetArg, class... Args>
-constexpr decltype(auto) set(I &&, SetArg &&, Args &&...);
+constexpr decltype(auto) set(I &&, SetArg &&, Args &&...) noexcept(
+    noexcept(invoke<T, Generator>(::std::declval<I>(),
+                                  ::std::declval<Args>()...) =
+                 ::std::declval<SetArg>()));
 
 namespace detail {
 
 /**
- * @brief  Implementation of invoke function
+ * @brief  Implementation of invoke function, noexcept if invocation of element
+ * is noexcept
  * @param p - metadata of element
  * @param args - Arguments of invocation
  * @return T::return_type
  */
 template <class T, class... Args>
-constexpr decltype(auto) invoke_impl(T &&p, Args &&... args) {
+constexpr decltype(auto) invoke_impl(T p, Args &&... args) noexcept(
+    is_nothrow_invoke_impl<T, Args &&...>()) {
   if constexpr (::std::decay_t<decltype(::boost::hana::size(
                     ::std::declval<typename T::arg_types>()))>::value != 0)
     return p(::std::forward<Args>(args)...);
   else
     return p();
 }
+
+/**
+ * @brief Calls visitor for element I
+ * @param obj - object
+ * @param visitor - visitor
+ * @return result of visitor
+ */
+template <class Result, class Obj, class Visitor, long long I>
+constexpr Result visit_member_thunk(Obj &&obj, Visitor &&visitor) {
+  return ::std::forward<Visitor>(visitor)(::boost::hana::llong_c<I>,
+                                          ::std::forward<Obj>(obj));
+}
+
+/**
+ * @brief Table of visitor thunks, one per element selected by the generator
+ */
+template <class Result, class Obj, class Visitor, class Indices>
+struct visit_member_table;
+
+/**
+ * @brief Table of visitor thunks (template spetialization for
+ * std::integer_sequence)
+ */
+template <class Result, class Obj, class Visitor, long long... Indices>
+struct visit_member_table<Result, Obj, Visitor,
+                          ::std::integer_sequence<long long, Indices...>> {
+  using thunk_type = Result (*)(Obj &&, Visitor &&); /**< Thunk type */
+  static constexpr thunk_type value[] = {
+      &visit_member_thunk<Result, Obj, Visitor, Indices>...}; /**< Thunks */
+};
 } // namespace detail
 
 /**
- * @brief invoke a method/variable
+ * @brief invoke a method/variable, noexcept if invocation of element is
+ * noexcept (see is_nothrow_invocable_member)
  * @param index - index of element to invoke (boost::hana::llong)
  * @param args - Invocation arguments
  * @return object which type is type of variable or result type of
@@ -48,7 +91,9 @@ constexpr decltype(auto) invoke_impl(T &&p, Args &&... args) {
  * boost::hana::nothing if error occurs
  */
 template <class T, class Generator, class I, class... Args>
-constexpr decltype(auto) invoke(I &&index, Args &&... args) {
+constexpr decltype(auto) invoke(I &&index, Args &&... args) noexcept(
+    detail::is_nothrow_invoke_impl<selected_item_t<T, Generator, I>,
+                                   Args &&...>()) {
 #ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
   static_assert(decltype(check_reflected<T>())::value,
                 "Class must be reflected");
@@ -60,13 +105,80 @@ constexpr decltype(auto) invoke(I &&index, Args &&... args) {
       "Index must be an integral constant of long long");
 #endif
   return detail::invoke_impl(
-      ::boost::hana::at(
-          metautils::copy_tuple_sequence(
-              MetaClass<T>::metadata,
-              Generator::template generate<decltype(MetaClass<T>::metadata)>()),
-          index),
+      ::boost::hana::at(selected_metadata_v<T, Generator>, index),
       ::std::forward<Args>(args)...);
 }
+
+/**
+ * @brief Get a variable or result of method
+ * @param index - index of element (boost::hana::llong)
+ * @param args - Invocation arguments (object for object variables/methods)
+ * @return result of invoke
+ */
+template <class T, class Generator, class I, class... Args>
+constexpr decltype(auto) get(I &&index, Args &&... args) noexcept(
+    noexcept(invoke<T, Generator>(::std::declval<I>(),
+                                  ::std::declval<Args>()...))) {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+  static_assert(decltype(check_invoke<T, Generator, Args &&...>(index))::value,
+                "Element can't be invoked with given arguments");
+#endif
+  return invoke<T, Generator>(::std::forward<I>(index),
+                              ::std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Assign a value to variable or to result of method
+ * @param index - index of element (boost::hana::llong)
+ * @param value - assigned value
+ * @param args - Invocation arguments (object for object variables/methods)
+ * @return result of assignment (reference to variable)
+ */
+template <class T, class Generator, class I, class SetArg, class... Args>
+constexpr decltype(auto)
+set(I &&index, SetArg &&value, Args &&... args) noexcept(
+    noexcept(invoke<T, Generator>(::std::declval<I>(),
+                                  ::std::declval<Args>()...) =
+                 ::std::declval<SetArg>())) {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+  static_assert(
+      decltype(check_set<T, Generator, SetArg &&, Args &&...>(index))::value,
+      "Element can't be assigned with given arguments");
+#endif
+  return invoke<T, Generator>(::std::forward<I>(index),
+                              ::std::forward<Args>(args)...) =
+             ::std::forward<SetArg>(value);
+}
+
+/**
+ * @brief Visit element by runtime index. Visitor is called with compile-time
+ * index (boost::hana::llong) and obj, dispatch is one indirect call through
+ * constexpr table of thunks. All calls of visitor must return the same type
+ * @param obj - object passed to visitor
+ * @param index - runtime index of element, must be less than amount of
+ * elements selected by the generator
+ * @param visitor - visitor
+ * @return result of visitor
+ */
+template <class T, class Generator = info::DefaultIndexGenerator, class Obj,
+          class Visitor>
+constexpr decltype(auto) visit_member(Obj &&obj, ::std::size_t index,
+                                      Visitor &&visitor) {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+  static_assert(decltype(check_reflected<T>())::value,
+                "Class must be reflected");
+  static_assert(info::is_generator_v<::std::decay_t<Generator>>,
+                "Generator is not a generator class");
+  static_assert(selected_count_v<T, Generator> > 0,
+                "Generator must select at least one element");
+#endif
+  using Result = decltype(::std::forward<Visitor>(visitor)(
+      ::boost::hana::llong_c<0>, ::std::forward<Obj>(obj)));
+  return detail::visit_member_table<
+      Result, Obj, Visitor,
+      ::std::make_integer_sequence<long long, selected_count_v<T, Generator>>>::
+      value[index](::std::forward<Obj>(obj), ::std::forward<Visitor>(visitor));
+}
 } // namespace utils
 } // namespace reflect
 
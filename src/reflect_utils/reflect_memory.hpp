@@ -0,0 +1,56 @@
+#ifndef REFLECT_MEMORY_HPP
+#define REFLECT_MEMORY_HPP
+
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+
+namespace reflect {
+
+namespace utils {
+
+/**
+ * @brief Checks if container T allocates memory by
+ * std::pmr::polymorphic_allocator
+ */
+template <class T, class = void>
+struct uses_memory_resource : ::std::false_type {};
+
+/**
+ * @brief Checks if container T allocates memory by
+ * std::pmr::polymorphic_allocator (template spetialization for types with
+ * allocator_type)
+ */
+template <class T>
+struct uses_memory_resource<T, ::std::void_t<typename T::allocator_type>>
+    : ::std::is_same<typename T::allocator_type,
+                     ::std::pmr::polymorphic_allocator<
+                         typename T::allocator_type::value_type>> {};
+
+template <class T>
+constexpr bool uses_memory_resource_v =
+    uses_memory_resource<T>::value; /**< Helper variable template for
+                                       uses_memory_resource */
+
+/**
+ * @brief Makes container allocate memory from resource. Allocator of
+ * polymorphic_allocator container can't be replaced, so container which uses
+ * other resource is destroyed and constructed empty with resource. Containers
+ * with other allocators and nullptr resource are left as is
+ * @param container - container to be filled
+ * @param resource - memory resource or nullptr
+ */
+template <class T>
+void use_memory_resource(
+    T &container, [[maybe_unused]] ::std::pmr::memory_resource *resource) {
+  if constexpr (uses_memory_resource_v<T>)
+    if (resource && container.get_allocator().resource() != resource) {
+      ::std::destroy_at(::std::addressof(container));
+      ::new (static_cast<void *>(::std::addressof(container))) T(resource);
+    }
+}
+} // namespace utils
+} // namespace reflect
+
+#endif // REFLECT_MEMORY_HPP
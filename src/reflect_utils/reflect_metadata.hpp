@@ -17,6 +17,130 @@ using MetaClass = info::MetaClass<typename ::std::decay_t<
 
 template <class T> using Parents = typename MetaClass<T>::Parent_types;
 
+/**
+ * @brief Indices of elements selected by the generator. Generated once per
+ * (T, Generator) pair, all utils must use it instead of calling
+ * Generator::generate directly
+ */
+template <class T, class Generator>
+constexpr auto selected_indices_v{Generator::template generate<
+    decltype(MetaClass<T>::metadata)>()};
+
+/**
+ * @brief Type of metadata tuple selected by the generator. Must be used in
+ * unevaluated contexts instead of selected_metadata_v, so pointers to members
+ * are not odr-used
+ */
+template <class T, class Generator> struct selected_metadata {
+  using type = ::std::decay_t<decltype(metautils::copy_tuple_sequence(
+      MetaClass<T>::metadata, selected_indices_v<T, Generator>))>;
+};
+
+template <class T, class Generator>
+using selected_metadata_t =
+    typename selected_metadata<T, Generator>::type; /**< Helper type template
+                                                       for selected_metadata */
+
+/**
+ * @brief Type of element selected by the generator at index I
+ */
+template <class T, class Generator, class I>
+using selected_item_t = ::std::decay_t<decltype(::boost::hana::at(
+    ::std::declval<selected_metadata_t<T, Generator>>(),
+    ::std::declval<::std::decay_t<I>>()))>;
+
+template <class T, class Generator>
+constexpr long long selected_count_v = decltype(::boost::hana::size(
+    ::std::declval<selected_metadata_t<T, Generator>>()))::value; /**< Amount
+                                       of elements selected by the generator */
+
+/**
+ * @brief Metadata of elements selected by the generator (memoized)
+ */
+template <class T, class Generator>
+constexpr selected_metadata_t<T, Generator> selected_metadata_v{
+    metautils::copy_tuple_sequence(MetaClass<T>::metadata,
+                                   selected_indices_v<T, Generator>)};
+
+/**
+ * @brief Names of elements selected by the generator (memoized)
+ */
+template <class T, class Generator>
+constexpr auto selected_names_v{metautils::copy_tuple_sequence(
+    MetaClass<T>::names, selected_indices_v<T, Generator>)};
+
+namespace detail {
+
+/**
+ * @brief Copy hashes of elements by the given element indices
+ * @param hashes - std::array of hashes of all elements
+ * @param boost::hana::tuple<boost::hana::llong<Indices>...> - element indices
+ * @return std::array of hashes
+ */
+template <class Hashes, long long... Indices>
+constexpr decltype(auto) copy_hashes_sequence(
+    const Hashes &hashes,
+    const ::boost::hana::tuple<::boost::hana::llong<Indices>...> &) {
+  return ::std::array<unsigned long long, sizeof...(Indices)>{
+      {hashes[Indices]...}};
+}
+} // namespace detail
+
+/**
+ * @brief Hash table of names of elements selected by the generator (memoized)
+ */
+template <class T, class Generator>
+constexpr metautils::hash_table<selected_count_v<T, Generator>>
+    selected_name_table_v{detail::copy_hashes_sequence(
+        MetaClass<T>::name_hashes, selected_indices_v<T, Generator>)};
+
+namespace detail {
+
+template <class T> constexpr bool is_borrowing_impl();
+
+/**
+ * @brief Checks if any of items is borrowing
+ * @param boost::hana::tuple<Items...> - items of metadata
+ */
+template <class... Items>
+constexpr bool
+is_any_borrowing_impl(const ::boost::hana::tuple<Items...> *) {
+  return (false || ... || is_borrowing_impl<info::item_value_t<Items>>());
+}
+
+/**
+ * @brief Checks if T is view, std::vector of borrowing types or reflected
+ * class with borrowing object variable
+ */
+template <class T> constexpr bool is_borrowing_impl() {
+  if constexpr (metautils::is_view_v<T>)
+    return true;
+  else if constexpr (metautils::is_vector_v<T>)
+    return is_borrowing_impl<typename T::value_type>();
+  else if constexpr (info::is_reflected_v<T>)
+    return is_any_borrowing_impl(
+        static_cast<const selected_metadata_t<
+            T, info::ObjectIndexGenerator<info::VariableIndexGenerator<
+                   info::DefaultIndexGenerator>>> *>(nullptr));
+  else
+    return false;
+}
+} // namespace detail
+
+/**
+ * @brief Checks if T refers to memory it doesn't own: T is std::string_view,
+ * std::span, std::vector of borrowing types or reflected class with borrowing
+ * object variable (including inherited ones). Deserialized borrowing objects
+ * point into input, so input must outlive them
+ */
+template <class T>
+struct is_borrowing
+    : ::std::bool_constant<detail::is_borrowing_impl<::std::decay_t<T>>()> {};
+
+template <class T>
+constexpr bool is_borrowing_v =
+    is_borrowing<T>::value; /**< Helper variable template for is_borrowing */
+
 template <class T, class Generator = info::DefaultIndexGenerator, class... Args,
           class I>
 constexpr decltype(auto) check_invoke(I &&);
@@ -64,6 +188,29 @@ struct parents_types_helper_impl<::boost::hana::tuple<Args...>> {
       parents_types<typename Args::type>()...)};
 };
 
+/**
+ * @brief Find element index by name implementation. Only elements with the
+ * same name hash are compared with the name
+ * @param std::index_sequence<Positions...> - positions of elements with the
+ * same name hash
+ * @return boost::hana::tuple_c<long long,...>
+ */
+template <class T, class Generator, class String, ::std::size_t... Positions>
+constexpr decltype(auto)
+find_by_name_impl(::std::index_sequence<Positions...> &&) {
+  [[maybe_unused]] constexpr auto candidates =
+      selected_name_table_v<T, Generator>.template find<sizeof...(Positions)>(
+          metautils::ct_string_hash_v<String>);
+  using Names = decltype(selected_names_v<T, Generator>);
+  return metautils::filter_indices(
+      ::std::integer_sequence<
+          bool,
+          ::std::is_same_v<
+              String,
+              metautils::tuple_item_t<candidates[Positions], Names>>...>(),
+      ::boost::hana::tuple<::boost::hana::llong<candidates[Positions]>...>{});
+}
+
 /**
  * @brief Counting all parents
  */
@@ -78,25 +225,16 @@ constexpr decltype(auto) parents_count_unpack(::boost::hana::tuple<Args...>) {
  * @return boost::hana::tuple_t<...>
  */
 template <class T, class Generator, class I>
-constexpr decltype(auto) method_args_helper_method_impl(I &&index) {
+constexpr decltype(auto) method_args_helper_method_impl(I &&) {
 #ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
   static_assert(info::is_reflected_v<::std::decay_t<T>>,
                 "Class must be reflected");
   static_assert(info::is_generator_v<::std::decay_t<Generator>>,
                 "Generator is not a generator class");
-  static_assert(::std::decay_t<decltype(
-                        ::boost::hana::size(metautils::copy_tuple_sequence(
-                            MetaClass<T>::metadata,
-                            Generator::template generate<decltype(
-                                MetaClass<T>::metadata)>())))>::value >
-                    ::std::decay_t<I>::value,
+  static_assert(selected_count_v<T, Generator> > ::std::decay_t<I>::value,
                 "Index must be less than number of elements in the generator");
 #endif
-  return typename ::std::decay_t<decltype(::boost::hana::at(
-      metautils::copy_tuple_sequence(
-          MetaClass<T>::metadata,
-          Generator::template generate<decltype(MetaClass<T>::metadata)>()),
-      index))>::arg_types{};
+  return typename selected_item_t<T, Generator, I>::arg_types{};
 }
 
 /**
@@ -142,6 +280,21 @@ template <class... Args> constexpr decltype(auto) check_invoke_impl() {
     return ::boost::hana::bool_c<false>;
 }
 
+/**
+ * @brief Checks if invocation of element doesn't throw. Element without
+ * arguments is called without arguments (as in utils::invoke)
+ * @return true if element is invocable and invocation is noexcept
+ */
+template <class T, class... Args> constexpr bool is_nothrow_invoke_impl() {
+  if constexpr (!is_invocable_v<T &, Args...>)
+    return false;
+  else if constexpr (::std::decay_t<decltype(::boost::hana::size(
+                         ::std::declval<typename T::arg_types>()))>::value != 0)
+    return noexcept(::std::declval<T &>()(::std::declval<Args>()...));
+  else
+    return noexcept(::std::declval<T &>()());
+}
+
 /**
  * @brief Implementation of check_set
  * @return boost::hana::bool_c<true/false>
@@ -246,10 +399,7 @@ constexpr decltype(auto) count() {
 #endif
   // Forcing unevaluated context to not interact with data(only with
   // types)
-  return ::boost::hana::llong_c<decltype(
-      ::boost::hana::size(metautils::copy_tuple_sequence(
-          MetaClass<T>::metadata, Generator::template generate<decltype(
-                                      MetaClass<T>::metadata)>())))::value>;
+  return ::boost::hana::llong_c<selected_count_v<T, Generator>>;
 }
 
 /**
@@ -269,26 +419,20 @@ constexpr decltype(auto) member_name(I &&index) {
                        ::boost::hana::tag_of_t<I>>,
       "Index must be an integral constant of long long");
   static_assert(
-      decltype(::boost::hana::size(metautils::copy_tuple_sequence(
-          MetaClass<T>::names, Generator::template generate<decltype(
-                                   MetaClass<T>::metadata)>())))::value >
-          ::std::decay_t<I>::value,
+      selected_count_v<T, Generator> > ::std::decay_t<I>::value,
       "Index must be less than number of elements in the generator");
 #endif
-  return ::boost::hana::at(
-      metautils::copy_tuple_sequence(
-          MetaClass<T>::names,
-          Generator::template generate<decltype(MetaClass<T>::metadata)>()),
-      index);
+  return ::boost::hana::at(selected_names_v<T, Generator>, index);
 }
 
 /**
- * @brief Find element index by name
+ * @brief Find element index by name. Name is looked up in hash table of names,
+ * so only names with the same hash are compared
  * @param str - ct-string (boost::hana::string)
  * @return boost::hana::tuple_c<long long,...>
  */
 template <class T, class Generator = info::DefaultIndexGenerator, class String>
-constexpr decltype(auto) find_by_name(String &&str) {
+constexpr decltype(auto) find_by_name([[maybe_unused]] String &&str) {
 #ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
   static_assert(decltype(check_reflected<T>())::value,
                 "Class must be reflected");
@@ -298,11 +442,10 @@ constexpr decltype(auto) find_by_name(String &&str) {
                                  ::boost::hana::tag_of_t<String>>,
                 "str must be a ct-string");
 #endif
-  return metautils::find_value_types(
-      str,
-      metautils::copy_tuple_sequence(
-          MetaClass<T>::names,
-          Generator::template generate<decltype(MetaClass<T>::metadata)>()));
+  using Name = ::std::decay_t<String>;
+  return detail::find_by_name_impl<T, Generator, Name>(
+      ::std::make_index_sequence<selected_name_table_v<T, Generator>.count(
+          metautils::ct_string_hash_v<Name>)>());
 }
 
 /**
@@ -326,7 +469,7 @@ constexpr decltype(auto) find_by_name_first(String &&str) {
  * @return boost::hana::tuple_t<Types...>
  */
 template <class T, class Generator = info::DefaultIndexGenerator, class I>
-constexpr decltype(auto) method_args(I &&index) {
+constexpr decltype(auto) method_args(I &&) {
 #ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
   static_assert(decltype(check_reflected<T>())::value,
                 "Class must be reflected");
@@ -337,17 +480,10 @@ constexpr decltype(auto) method_args(I &&index) {
                        ::boost::hana::tag_of_t<I>>,
       "Index must be an integral constant of long long");
   static_assert(
-      decltype(::boost::hana::size(metautils::copy_tuple_sequence(
-          MetaClass<T>::names, Generator::template generate<decltype(
-                                   MetaClass<T>::metadata)>())))::value >
-          ::std::decay_t<I>::value,
+      selected_count_v<T, Generator> > ::std::decay_t<I>::value,
       "Index must be less than number of elements in the generator");
 #endif
-  return typename ::std::decay_t<decltype(::boost::hana::at(
-      metautils::copy_tuple_sequence(
-          MetaClass<T>::metadata,
-          Generator::template generate<decltype(MetaClass<T>::metadata)>()),
-      index))>::arg_types{};
+  return typename selected_item_t<T, Generator, I>::arg_types{};
 }
 
 /**
@@ -366,7 +502,7 @@ constexpr decltype(auto) methods_args_count(I &&index) {
  * @return boost::hana::type_t<...>
  */
 template <class T, class Generator = info::DefaultIndexGenerator, class I>
-constexpr decltype(auto) result_type(I &&index) {
+constexpr decltype(auto) result_type(I &&) {
 #ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
   static_assert(decltype(check_reflected<T>())::value,
                 "Class must be reflected");
@@ -377,18 +513,11 @@ constexpr decltype(auto) result_type(I &&index) {
                        ::boost::hana::tag_of_t<I>>,
       "Index must be an integral constant of long long");
   static_assert(
-      decltype(::boost::hana::size(metautils::copy_tuple_sequence(
-          MetaClass<T>::names, Generator::template generate<decltype(
-                                   MetaClass<T>::metadata)>())))::value >
-          ::std::decay_t<I>::value,
+      selected_count_v<T, Generator> > ::std::decay_t<I>::value,
       "Index must be less than number of elements in the generator");
 #endif
   return ::boost::hana::type_c<
-      typename ::std::decay_t<decltype(::boost::hana::at(
-          metautils::copy_tuple_sequence(
-              MetaClass<T>::metadata,
-              Generator::template generate<decltype(MetaClass<T>::metadata)>()),
-          index))>::return_type>;
+      typename selected_item_t<T, Generator, I>::return_type>;
 }
 
 /**
@@ -422,7 +551,7 @@ constexpr decltype(auto) method_arg(I &&index1, J &&index2) {
  * false if method can be invoked)
  */
 template <class T, class Generator, class... Args, class I>
-constexpr decltype(auto) check_invoke(I &&index) {
+constexpr decltype(auto) check_invoke(I &&) {
 #ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
   static_assert(decltype(check_reflected<T>())::value,
                 "Class must be reflected");
@@ -433,21 +562,40 @@ constexpr decltype(auto) check_invoke(I &&index) {
                        ::boost::hana::tag_of_t<I>>,
       "Index must be an integral constant of long long");
   static_assert(
-      decltype(::boost::hana::size(metautils::copy_tuple_sequence(
-          MetaClass<T>::names, Generator::template generate<decltype(
-                                   MetaClass<T>::metadata)>())))::value >
-          ::std::decay_t<I>::value,
+      selected_count_v<T, Generator> > ::std::decay_t<I>::value,
       "Index must be less than number of elements in the generator");
 #endif
   return detail::check_invoke_impl<
-      ::std::decay_t<decltype(::boost::hana::at(
-          metautils::copy_tuple_sequence(
-              MetaClass<T>::metadata,
-              Generator::template generate<decltype(MetaClass<T>::metadata)>()),
-          index))>,
+      selected_item_t<T, Generator, I>,
       Args...>();
 }
 
+/**
+ * @brief Checks whether invocation of method/variable by utils::invoke is
+ * noexcept (e.g. to select move_if_noexcept-like code paths)
+ * @param index - index(boost::hana::llong)
+ * @return boost::hana::bool_c<true/false> (false if element can't be invoked
+ * with given arguments)
+ */
+template <class T, class Generator, class... Args, class I>
+constexpr decltype(auto) is_nothrow_invocable_member(I &&) {
+#ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
+  static_assert(decltype(check_reflected<T>())::value,
+                "Class must be reflected");
+  static_assert(info::is_generator_v<::std::decay_t<Generator>>,
+                "Generator is not a generator class");
+  static_assert(
+      ::std::is_same_v<::boost::hana::integral_constant_tag<long long>,
+                       ::boost::hana::tag_of_t<I>>,
+      "Index must be an integral constant of long long");
+  static_assert(
+      selected_count_v<T, Generator> > ::std::decay_t<I>::value,
+      "Index must be less than number of elements in the generator");
+#endif
+  return ::boost::hana::bool_c<detail::is_nothrow_invoke_impl<
+      selected_item_t<T, Generator, I>, Args...>()>;
+}
+
 /**
  * @brief Check if we can assign to return value(or value) of method/variable
  * @param index - index(boost::hana::llong)
@@ -455,7 +603,7 @@ constexpr decltype(auto) check_invoke(I &&index) {
  * false if method can be invoked)
  */
 template <class T, class Generator, class SetArg, class... Args, class I>
-constexpr decltype(auto) check_set(I &&index) {
+constexpr decltype(auto) check_set(I &&) {
 #ifndef COUSOUS_DISABLE_MOST_CT_CHECKS
   static_assert(decltype(check_reflected<T>())::value,
                 "Class must be reflected");
@@ -466,18 +614,11 @@ constexpr decltype(auto) check_set(I &&index) {
                        ::boost::hana::tag_of_t<I>>,
       "Index must be an integral constant of long long");
   static_assert(
-      decltype(::boost::hana::size(metautils::copy_tuple_sequence(
-          MetaClass<T>::names, Generator::template generate<decltype(
-                                   MetaClass<T>::metadata)>())))::value >
-          ::std::decay_t<I>::value,
+      selected_count_v<T, Generator> > ::std::decay_t<I>::value,
       "Index must be less than number of elements in the generator");
 #endif
   return detail::check_set_impl<
-      ::std::decay_t<decltype(::boost::hana::at(
-          metautils::copy_tuple_sequence(
-              MetaClass<T>::metadata,
-              Generator::template generate<decltype(MetaClass<T>::metadata)>()),
-          index))>,
+      selected_item_t<T, Generator, I>,
       SetArg, Args...>();
 }
 } // namespace utils
@@ -1,7 +1,11 @@
 #ifndef REFLECT_UTILS_HPP
 #define REFLECT_UTILS_HPP
 
+#include "reflect_compare.hpp"
+#include "reflect_diff.hpp"
+#include "reflect_enum.hpp"
 #include "reflect_invokes.hpp"
+#include "reflect_memory.hpp"
 #include "reflect_metadata.hpp"
 
 namespace reflect {
@@ -0,0 +1,227 @@
+#include <QtTest>
+#include <map>
+#include <reflect.hpp>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+struct ComparePoint {
+  int x{0};
+  int y{0};
+  IN_METAINFO(ComparePoint)
+  REFLECT_OBJ_VAR(x)
+  REFLECT_OBJ_VAR(y)
+};
+
+struct CompareParent {
+  long long id{0};
+  OUT_METAINFO(CompareParent)
+};
+
+METAINFO(CompareParent)
+REFLECT_OBJ_VAR(id)
+END_METAINFO
+
+struct CompareChild : CompareParent {
+  ComparePoint point;
+  std::string name;
+  std::vector<ComparePoint> path;
+  int ignored{0};
+  IN_METAINFO(CompareChild, CompareParent)
+  REFLECT_OBJ_VAR(point)
+  REFLECT_OBJ_VAR(name)
+  REFLECT_OBJ_VAR(path)
+};
+
+struct CompareBytes {
+  unsigned char a{0};
+  unsigned char b{0};
+  bool c{false};
+  IN_METAINFO(CompareBytes)
+  REFLECT_OBJ_VAR(a)
+  REFLECT_OBJ_VAR(b)
+  REFLECT_OBJ_VAR(c)
+};
+
+struct ComparePadded {
+  char a{0};
+  int b{0};
+  IN_METAINFO(ComparePadded)
+  REFLECT_OBJ_VAR(a)
+  REFLECT_OBJ_VAR(b)
+};
+
+struct ComparePartial {
+  int a{0};
+  int b{0};
+  IN_METAINFO(ComparePartial)
+  REFLECT_OBJ_VAR(a)
+};
+
+struct CompareWide {
+  int v0{0}, v1{0}, v2{0}, v3{0}, v4{0}, v5{0}, v6{0}, v7{0}, v8{0};
+  IN_METAINFO(CompareWide)
+  REFLECT_OBJ_VAR(v0)
+  REFLECT_OBJ_VAR(v1)
+  REFLECT_OBJ_VAR(v2)
+  REFLECT_OBJ_VAR(v3)
+  REFLECT_OBJ_VAR(v4)
+  REFLECT_OBJ_VAR(v5)
+  REFLECT_OBJ_VAR(v6)
+  REFLECT_OBJ_VAR(v7)
+  REFLECT_OBJ_VAR(v8)
+};
+
+class CompareTest : public QObject {
+  Q_OBJECT
+private slots:
+  void bytes_comparable();
+  void hash_equal();
+  void compare();
+  void diff();
+};
+
+void CompareTest::bytes_comparable() {
+  QVERIFY(reflect::utils::is_bytes_comparable_v<ComparePoint>);
+  QVERIFY(reflect::utils::is_bytes_comparable_v<CompareBytes>);
+  QVERIFY(!reflect::utils::is_bytes_comparable_v<ComparePadded>);
+  QVERIFY(!reflect::utils::is_bytes_comparable_v<ComparePartial>);
+  QVERIFY(!reflect::utils::is_bytes_comparable_v<CompareChild>);
+}
+
+void CompareTest::hash_equal() {
+  reflect::utils::equal<ComparePoint> point_equal;
+  reflect::utils::hash<ComparePoint> point_hash;
+  QVERIFY(point_equal({1, 2}, {1, 2}));
+  QVERIFY(!point_equal({1, 2}, {1, 3}));
+  QCOMPARE(point_hash({1, 2}), point_hash({1, 2}));
+  QVERIFY(point_hash({1, 2}) != point_hash({2, 1}));
+
+  ComparePartial partial1{1, 2}, partial2{1, 3};
+  QVERIFY(reflect::utils::equal<ComparePartial>{}(partial1, partial2));
+  QCOMPARE(reflect::utils::hash<ComparePartial>{}(partial1),
+           reflect::utils::hash<ComparePartial>{}(partial2));
+
+  CompareChild child1;
+  child1.id = 1;
+  child1.point = {2, 3};
+  child1.name = "name";
+  child1.path = {{1, 1}, {2, 2}};
+  child1.ignored = 1;
+  CompareChild child2 = child1;
+  child2.ignored = 2;
+  reflect::utils::equal<CompareChild> child_equal;
+  reflect::utils::hash<CompareChild> child_hash;
+  QVERIFY(child_equal(child1, child2));
+  QCOMPARE(child_hash(child1), child_hash(child2));
+  child2.path[1].y = 3;
+  QVERIFY(!child_equal(child1, child2));
+  child2 = child1;
+  child2.id = 5;
+  QVERIFY(!child_equal(child1, child2));
+
+  std::unordered_set<CompareChild, reflect::utils::hash<CompareChild>,
+                     reflect::utils::equal<CompareChild>>
+      set{child1, child2};
+  QCOMPARE(set.size(), std::size_t{2});
+  QCOMPARE(set.count(child1), std::size_t{1});
+}
+
+void CompareTest::compare() {
+  reflect::utils::compare<ComparePoint> point_compare;
+  QVERIFY(point_compare({1, 2}, {1, 3}) < 0);
+  QVERIFY(point_compare({2, 0}, {1, 3}) > 0);
+  QVERIFY(point_compare({-1, 0}, {1, 0}) < 0);
+  QCOMPARE(point_compare({1, 2}, {1, 2}), 0);
+
+  reflect::utils::compare<CompareBytes> bytes_compare;
+  QVERIFY(bytes_compare({1, 200, false}, {2, 0, false}) < 0);
+  QVERIFY(bytes_compare({1, 2, true}, {1, 2, false}) > 0);
+  QCOMPARE(bytes_compare({1, 2, true}, {1, 2, true}), 0);
+
+  CompareChild child1;
+  child1.id = 1;
+  child1.name = "b";
+  CompareChild child2 = child1;
+  child2.name = "a";
+  reflect::utils::compare<CompareChild> child_compare;
+  QVERIFY(child_compare(child1, child2) > 0);
+  child2.point.x = 1;
+  QVERIFY(child_compare(child1, child2) < 0);
+  child2 = child1;
+  child2.id = 0;
+  QVERIFY(child_compare(child1, child2) > 0);
+  child2 = child1;
+  child2.path = {{0, 0}};
+  QVERIFY(child_compare(child1, child2) < 0);
+
+  std::map<ComparePoint, int, reflect::utils::less<ComparePoint>> map;
+  map[{2, 1}] = 1;
+  map[{1, 5}] = 2;
+  map[{1, 2}] = 3;
+  QCOMPARE(map.begin()->second, 3);
+  QCOMPARE(map.rbegin()->second, 1);
+}
+
+void CompareTest::diff() {
+  using Mask = reflect::utils::member_mask_t<CompareChild>;
+  QCOMPARE(Mask::size(), std::size_t{4});
+  QCOMPARE(Mask::words_count, std::size_t{1});
+
+  CompareChild child1;
+  child1.id = 1;
+  child1.point = {2, 3};
+  child1.name = "name";
+  CompareChild child2 = child1;
+  child2.ignored = 1;
+  QVERIFY(!reflect::utils::diff(child1, child2).any());
+
+  // positions: point, name, path, id
+  child2.name = "other";
+  child2.id = 2;
+  Mask mask = reflect::utils::diff(child1, child2);
+  QCOMPARE(mask.count(), std::size_t{2});
+  QVERIFY(!mask.test(0));
+  QVERIFY(mask.test(1));
+  QVERIFY(!mask.test(2));
+  QVERIFY(mask.test(3));
+
+  CompareChild patched = child1;
+  patched.point = {5, 5};
+  reflect::utils::apply_patch(patched, mask, child2);
+  QCOMPARE(patched.name, std::string("other"));
+  QCOMPARE(patched.id, 2ll);
+  QCOMPARE(patched.point.x, 5);
+
+  ComparePoint point1{1, 2}, point2{1, 2};
+  QVERIFY(!reflect::utils::diff(point1, point2).any());
+  point2.y = 3;
+  auto point_mask = reflect::utils::diff(point1, point2);
+  QVERIFY(!point_mask.test(0));
+  QVERIFY(point_mask.test(1));
+  reflect::utils::apply_patch(point1, point_mask, point2);
+  QCOMPARE(point1.y, 3);
+
+  CompareWide wide1, wide2;
+  wide2.v7 = 7;
+  auto wide_mask = reflect::utils::diff(wide1, wide2);
+  QCOMPARE(wide_mask.count(), std::size_t{1});
+  QVERIFY(wide_mask.test(7));
+  reflect::utils::apply_patch(wide1, wide_mask, wide2);
+  QCOMPARE(wide1.v7, 7);
+  QVERIFY(!reflect::utils::diff(wide1, wide2).any());
+
+  reflect::utils::member_mask<70> wide;
+  wide.set(69);
+  wide.set(3);
+  QCOMPARE(wide.count(), std::size_t{2});
+  QVERIFY(wide.test(69));
+  wide.set(69, false);
+  QVERIFY(!wide.test(69));
+  QVERIFY(wide != reflect::utils::member_mask<70>{});
+  wide.reset();
+  QVERIFY(!wide.any());
+}
+
+QTEST_MAIN(CompareTest)
+#include "main.moc"
@@ -0,0 +1,197 @@
+#include <QtTest>
+#include <limits>
+#include <reflect.hpp>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+struct ContainersParent {
+  long long id{0};
+  OUT_METAINFO(ContainersParent)
+};
+
+METAINFO(ContainersParent)
+REFLECT_OBJ_VAR(id)
+END_METAINFO
+
+struct ContainersChild : ContainersParent {
+  double price{0};
+  int quantity{0};
+  std::string name;
+  static int static_var;
+  IN_METAINFO(ContainersChild, ContainersParent)
+  REFLECT_OBJ_VAR(price)
+  REFLECT_OBJ_VAR(quantity)
+  REFLECT_STATIC_VAR(static_var)
+  REFLECT_OBJ_VAR(name)
+};
+
+int ContainersChild::static_var = 0;
+
+class ContainersTest : public QObject {
+  Q_OBJECT
+private slots:
+  void soa_vector();
+  void aggregate();
+  void tracked();
+};
+
+void ContainersTest::soa_vector() {
+  using namespace boost::hana::literals;
+  using Soa = reflect::containers::soa_vector<ContainersChild>;
+  QCOMPARE(Soa::columns_count, std::size_t{4});
+  QVERIFY((std::is_same_v<std::decay_t<decltype(
+                              std::declval<Soa &>().column("price"_s))>,
+                          std::vector<double>>));
+  QVERIFY((std::is_same_v<std::decay_t<decltype(
+                              std::declval<Soa &>().column("id"_s))>,
+                          std::vector<long long>>));
+
+  Soa soa;
+  QVERIFY(soa.empty());
+  soa.reserve(3);
+  for (int i = 0; i < 3; ++i) {
+    ContainersChild child;
+    child.id = 10 + i;
+    child.price = 1.5 * i;
+    child.quantity = i;
+    child.name = "item" + std::to_string(i);
+    soa.push_back(child);
+  }
+  QCOMPARE(soa.size(), std::size_t{3});
+  QCOMPARE(soa.column("price"_s), (std::vector<double>{0, 1.5, 3}));
+  QCOMPARE(soa.column("quantity"_s), (std::vector<int>{0, 1, 2}));
+  QCOMPARE(soa.column("id"_s), (std::vector<long long>{10, 11, 12}));
+  QCOMPARE(soa.column("name"_s)[2], std::string("item2"));
+
+  soa[1]["quantity"_s] = 5;
+  QCOMPARE(soa.column("quantity"_s)[1], 5);
+  QCOMPARE(soa[1]["id"_s], 11ll);
+  const Soa &const_soa = soa;
+  QCOMPARE(const_soa[2]["name"_s], std::string("item2"));
+  QVERIFY((std::is_const_v<
+           std::remove_reference_t<decltype(const_soa[0]["price"_s])>>));
+
+  ContainersChild loaded = soa[1].load();
+  QCOMPARE(loaded.id, 11ll);
+  QCOMPARE(loaded.price, 1.5);
+  QCOMPARE(loaded.quantity, 5);
+  QCOMPARE(loaded.name, std::string("item1"));
+
+  loaded.name = "stored";
+  loaded.id = 20;
+  soa[0] = loaded;
+  QCOMPARE(soa[0]["name"_s], std::string("stored"));
+  QCOMPARE(soa[0]["id"_s], 20ll);
+
+  soa.pop_back();
+  QCOMPARE(soa.size(), std::size_t{2});
+  QCOMPARE(soa.column("name"_s).size(), std::size_t{2});
+  soa.clear();
+  QVERIFY(soa.empty());
+}
+
+void ContainersTest::aggregate() {
+  using namespace boost::hana::literals;
+  using Aggregates = reflect::containers::aggregates<ContainersChild>;
+  QCOMPARE(Aggregates::fields_count, std::size_t{3});
+  QVERIFY((std::is_same_v<std::decay_t<decltype(
+                              std::declval<Aggregates &>()["quantity"_s])>,
+                          reflect::containers::field_stats<int>>));
+
+  std::vector<ContainersChild> objects(40000);
+  reflect::containers::soa_vector<ContainersChild> soa;
+  for (int i = 0; i < 40000; ++i) {
+    objects[i].id = i;
+    objects[i].price = 0.5 * (i % 100);
+    objects[i].quantity = i % 7 - 3;
+    soa.push_back(objects[i]);
+  }
+  for (auto threads : {std::size_t{1}, std::size_t{4}}) {
+    for (const auto &result :
+         {reflect::containers::aggregate<ContainersChild>(objects, threads),
+          reflect::containers::aggregate(soa, threads)}) {
+      QCOMPARE(result["id"_s].count, std::size_t{40000});
+      QCOMPARE(result["id"_s].sum, 40000ll * 39999 / 2);
+      QCOMPARE(result["id"_s].min, 0ll);
+      QCOMPARE(result["id"_s].max, 39999ll);
+      QCOMPARE(result["price"_s].sum, 400 * 0.5 * 4950);
+      QCOMPARE(result["price"_s].mean(), 24.75);
+      QCOMPARE(result["price"_s].max, 49.5);
+      QCOMPARE(result["quantity"_s].min, -3);
+      QCOMPARE(result["quantity"_s].max, 3);
+    }
+  }
+
+  using NotIntegral = reflect::Not<reflect::ByType<std::is_integral>>;
+  QCOMPARE((reflect::containers::aggregates<ContainersChild,
+                                            NotIntegral>::fields_count),
+           std::size_t{1});
+  const auto prices =
+      reflect::containers::aggregate<ContainersChild, NotIntegral>(objects);
+  QCOMPARE(prices["price"_s].min, 0.0);
+  const auto empty = reflect::containers::aggregate<ContainersChild>(
+      std::vector<ContainersChild>{});
+  QCOMPARE(empty["price"_s].count, std::size_t{0});
+  QCOMPARE(empty["price"_s].mean(), 0.0);
+  QCOMPARE(empty["price"_s].min,
+           reflect::containers::field_stats<double>::min_sentinel);
+
+  const double infinity = std::numeric_limits<double>::infinity();
+  for (double price : {infinity, -infinity}) {
+    std::vector<ContainersChild> infinite(9);
+    reflect::containers::soa_vector<ContainersChild> infinite_soa;
+    for (auto &object : infinite) {
+      object.price = price;
+      infinite_soa.push_back(object);
+    }
+    for (const auto &result :
+         {reflect::containers::aggregate<ContainersChild>(infinite),
+          reflect::containers::aggregate(infinite_soa)}) {
+      QCOMPARE(result["price"_s].min, price);
+      QCOMPARE(result["price"_s].max, price);
+    }
+  }
+}
+
+void ContainersTest::tracked() {
+  using namespace boost::hana::literals;
+  ContainersChild child;
+  child.id = 1;
+  child.name = "first";
+  reflect::tracked<ContainersChild> obj(child);
+  QVERIFY(!obj.is_dirty());
+  QCOMPARE(obj["name"_s], std::string("first"));
+  QVERIFY((std::is_const_v<std::remove_reference_t<decltype(obj["id"_s])>>));
+
+  obj.set("quantity"_s, 7);
+  obj.set<3>(2ll);
+  QCOMPARE(obj->quantity, 7);
+  QCOMPARE(obj.get<3>(), 2ll);
+  QVERIFY(obj.is_dirty());
+  QCOMPARE(obj.dirty().count(), std::size_t{2});
+  QVERIFY(obj.dirty().test(1));
+  QVERIFY(obj.dirty().test(3));
+  obj.set("quantity"_s, 8);
+  QCOMPARE(obj.dirty().count(), std::size_t{2});
+
+  std::string buffer;
+  reflect::binary::serialize_delta(obj.value(), obj.dirty(), buffer);
+  QCOMPARE(reflect::binary::delta_names<ContainersChild>(buffer),
+           (std::vector<std::string_view>{"quantity", "id"}));
+  QVERIFY(reflect::binary::deserialize_delta(buffer, child));
+  QCOMPARE(child.quantity, 8);
+  QCOMPARE(child.id, 2ll);
+  QCOMPARE(child.name, std::string("first"));
+
+  obj.clear_dirty();
+  QVERIFY(!obj.is_dirty());
+  obj.set("name"_s, "second");
+  QCOMPARE(obj.value().name, std::string("second"));
+  QCOMPARE(obj.dirty().count(), std::size_t{1});
+  QVERIFY(obj.dirty().test(2));
+}
+
+QTEST_MAIN(ContainersTest)
+#include "main.moc"
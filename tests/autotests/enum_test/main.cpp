@@ -0,0 +1,124 @@
+#include <QtTest>
+#include <optional>
+#include <reflect.hpp>
+#include <string>
+#include <string_view>
+
+namespace enum_test {
+
+enum class Color { red, green, blue, crimson = red };
+
+enum Sparse : short { low = -1000, middle = 7, high = 30000 };
+
+enum class Permissions : unsigned {
+  none = 0,
+  read = 1,
+  write = 2,
+  execute = 4,
+  read_write = 3
+};
+
+enum class Sampled { abcde, abcxe, other };
+
+enum class Unreflected { value };
+} // namespace enum_test
+
+REFLECT_ENUM(enum_test::Color, red, green, blue, crimson)
+REFLECT_ENUM(enum_test::Sparse, low, middle, high)
+REFLECT_ENUM(enum_test::Sampled, abcde, abcxe, other)
+REFLECT_FLAGS(enum_test::Permissions, none, read, write, execute, read_write)
+
+using enum_test::Color;
+using enum_test::Permissions;
+using enum_test::Sparse;
+
+class EnumTest : public QObject {
+  Q_OBJECT
+private slots:
+  void enum_information();
+  void enum_to_string();
+  void enum_from_string();
+  void flags();
+};
+
+void EnumTest::enum_information() {
+  QVERIFY(reflect::info::is_reflected_enum_v<Color>);
+  QVERIFY(reflect::info::is_reflected_enum_v<Sparse>);
+  QVERIFY(!reflect::info::is_reflected_enum_v<enum_test::Unreflected>);
+  QVERIFY(!reflect::info::is_reflected_enum_v<int>);
+  QVERIFY(reflect::info::is_flags_enum_v<Permissions>);
+  QVERIFY(!reflect::info::is_flags_enum_v<Color>);
+  QCOMPARE(reflect::utils::enum_names<Color>().size(), std::size_t{4});
+  QCOMPARE(reflect::utils::enum_names<Sparse>()[1], std::string_view("middle"));
+  QCOMPARE(reflect::utils::enum_values<Sparse>()[2], Sparse::high);
+  QVERIFY(reflect::utils::detail::enum_data<Color>::dense);
+  QVERIFY(!reflect::utils::detail::enum_data<Sparse>::dense);
+}
+
+void EnumTest::enum_to_string() {
+  static_assert(reflect::utils::enum_to_string(Color::blue) == "blue");
+  QCOMPARE(reflect::utils::enum_to_string(Color::green),
+           std::string_view("green"));
+  QCOMPARE(reflect::utils::enum_to_string(Color::crimson),
+           std::string_view("red"));
+  QVERIFY(reflect::utils::enum_to_string(static_cast<Color>(3)).empty());
+  QVERIFY(reflect::utils::enum_to_string(static_cast<Color>(-1)).empty());
+  QCOMPARE(reflect::utils::enum_to_string(Sparse::low),
+           std::string_view("low"));
+  QCOMPARE(reflect::utils::enum_to_string(Sparse::middle),
+           std::string_view("middle"));
+  QCOMPARE(reflect::utils::enum_to_string(Sparse::high),
+           std::string_view("high"));
+  QVERIFY(reflect::utils::enum_to_string(static_cast<Sparse>(8)).empty());
+  QVERIFY(reflect::utils::enum_to_string(static_cast<Sparse>(-1001)).empty());
+}
+
+void EnumTest::enum_from_string() {
+  static_assert(*reflect::utils::enum_from_string<Color>("blue") ==
+                Color::blue);
+  QCOMPARE(reflect::utils::enum_from_string<Color>("crimson"),
+           std::optional<Color>(Color::red));
+  QCOMPARE(reflect::utils::enum_from_string<Sparse>("low"),
+           std::optional<Sparse>(Sparse::low));
+  QVERIFY(!reflect::utils::enum_from_string<Color>("pink"));
+  QVERIFY(!reflect::utils::enum_from_string<Color>(""));
+  QVERIFY(!reflect::utils::enum_from_string<Color>("Red"));
+  QVERIFY(!reflect::utils::enum_from_string<Color>("gren"));
+
+  using Sampled = enum_test::Sampled;
+  QVERIFY(reflect::utils::detail::enum_data<Color>::sampled);
+  QVERIFY(!reflect::utils::detail::enum_data<Sampled>::sampled);
+  QCOMPARE(reflect::utils::enum_from_string<Sampled>("abcxe"),
+           std::optional<Sampled>(Sampled::abcxe));
+  QCOMPARE(reflect::utils::enum_from_string<Sampled>("abcde"),
+           std::optional<Sampled>(Sampled::abcde));
+  QVERIFY(!reflect::utils::enum_from_string<Sampled>("abcye"));
+}
+
+void EnumTest::flags() {
+  QCOMPARE(reflect::utils::flags_to_string(static_cast<Permissions>(7)),
+           std::optional<std::string>("read|write|execute"));
+  QCOMPARE(reflect::utils::flags_to_string(Permissions::read_write),
+           std::optional<std::string>("read|write"));
+  QCOMPARE(reflect::utils::flags_to_string(Permissions::none),
+           std::optional<std::string>("none"));
+  QVERIFY(!reflect::utils::flags_to_string(static_cast<Permissions>(9)));
+  std::string buffer = "flags: ";
+  QVERIFY(!reflect::utils::flags_to_string(static_cast<Permissions>(12),
+                                           buffer));
+  QCOMPARE(buffer, std::string("flags: "));
+  QVERIFY(reflect::utils::flags_to_string(Permissions::execute, buffer));
+  QCOMPARE(buffer, std::string("flags: execute"));
+
+  QCOMPARE(reflect::utils::flags_from_string<Permissions>("read | execute"),
+           std::optional<Permissions>(static_cast<Permissions>(5)));
+  QCOMPARE(reflect::utils::flags_from_string<Permissions>("read_write|read"),
+           std::optional<Permissions>(Permissions::read_write));
+  QCOMPARE(reflect::utils::flags_from_string<Permissions>(""),
+           std::optional<Permissions>(Permissions::none));
+  QVERIFY(!reflect::utils::flags_from_string<Permissions>("read|"));
+  QVERIFY(!reflect::utils::flags_from_string<Permissions>("read|delete"));
+}
+
+QTEST_MAIN(EnumTest)
+#include "main.moc"
@@ -1,4 +1,6 @@
 #include <QtTest>
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
 #include <reflect.hpp>
 
 using namespace boost::hana::literals;
@@ -30,6 +32,8 @@ private slots:
   void counter_const_method();
   void counter_static_method();
   void counter_method();
+  void counter_digits();
+  void long_names();
   void find_obj_vars();
   void find_static_vars();
   void find_vars();
@@ -37,6 +41,7 @@ private slots:
   void find_const_methods();
   void find_static_methods();
   void find_methods();
+  void find_hashed_names();
   void get_obj_method_types();
   void get_const_method_types();
   void get_static_method_types();
@@ -46,6 +51,8 @@ private slots:
   void check_static_invoke();
   void check_invoke();
   void check_set();
+  void selected_tables();
+  void predicate_generators();
 };
 
 METAINFO(MetadataTest)
@@ -172,6 +179,37 @@ void MetadataTest::counter_method() {
   QVERIFY((reflect::utils::count<Type, reflect::AllMethods>()) == 3_c);
 }
 
+#define WIDE_STRUCT_DECLARE_VAR(_, i, __) int BOOST_PP_CAT(var, i);
+#define WIDE_STRUCT_REFLECT_NAME(NAME) REFLECT_OBJ_VAR(NAME)
+#define WIDE_STRUCT_REFLECT_VAR(_, i, __)                                      \
+  WIDE_STRUCT_REFLECT_NAME(BOOST_PP_CAT(var, i))
+
+struct WideStruct {
+  BOOST_PP_REPEAT(70, WIDE_STRUCT_DECLARE_VAR, _)
+  IN_METAINFO(WideStruct)
+  BOOST_PP_REPEAT(70, WIDE_STRUCT_REFLECT_VAR, _)
+};
+
+void MetadataTest::counter_digits() {
+  QVERIFY((reflect::utils::count<WideStruct>()) == 70_c);
+  QVERIFY(reflect::utils::member_name<WideStruct>(63_c) == "var63"_s);
+  QVERIFY(reflect::utils::member_name<WideStruct>(64_c) == "var64"_s);
+  QVERIFY(reflect::utils::member_name<WideStruct>(69_c) == "var69"_s);
+}
+
+struct LongNames {
+  int variable_with_very_long_name_which_does_not_fit_into_sixty_four_chars;
+  IN_METAINFO(LongNames)
+  REFLECT_OBJ_VAR(
+      variable_with_very_long_name_which_does_not_fit_into_sixty_four_chars)
+};
+
+void MetadataTest::long_names() {
+  QVERIFY(
+      reflect::utils::member_name<LongNames>(0_c) ==
+      "variable_with_very_long_name_which_does_not_fit_into_sixty_four_chars"_s);
+}
+
 void MetadataTest::find_obj_vars() {
   auto tuple = reflect::metautils::for_each(
       boost::hana::make_tuple("var1"_s, "var2"_s), [](auto &&name) {
@@ -240,6 +278,18 @@ void MetadataTest::find_methods() {
   QVERIFY(tuple == (boost::hana::tuple_c<long long, 0, 1, 2>));
 }
 
+void MetadataTest::find_hashed_names() {
+  constexpr reflect::metautils::hash_table<4> table{{{7, 3, 7, 11}}};
+  static_assert(table.count(7) == 2);
+  static_assert(table.find<2>(7)[0] == 0 && table.find<2>(7)[1] == 2);
+  static_assert(table.count(5) == 0);
+  QVERIFY((reflect::utils::find_by_name_first<WideStruct>("var0"_s)) == 0_c);
+  QVERIFY((reflect::utils::find_by_name_first<WideStruct>("var42"_s)) == 42_c);
+  QVERIFY((reflect::utils::find_by_name_first<WideStruct>("var69"_s)) == 69_c);
+  QVERIFY((reflect::utils::find_by_name<WideStruct>("var70"_s)) ==
+          boost::hana::make_tuple());
+}
+
 void MetadataTest::get_obj_method_types() {
   auto tuple = reflect::metautils::for_each(
       reflect::metautils::gen_inds_tup<decltype(
@@ -402,5 +452,37 @@ void MetadataTest::check_set() {
            boost::hana::bool_c<false>);
 }
 
+void MetadataTest::selected_tables() {
+  QCOMPARE((reflect::utils::selected_count_v<Type, reflect::AllVars>), 3ll);
+  QCOMPARE((reflect::utils::selected_count_v<Type, reflect::ObjMethods>), 2ll);
+  QVERIFY((reflect::utils::selected_indices_v<Type, reflect::StaticVars> ==
+           boost::hana::make_tuple(2_c)));
+  QVERIFY((reflect::utils::selected_names_v<Type, reflect::AllMethods> ==
+           boost::hana::make_tuple("foo"_s, "foo"_s, "static_foo"_s)));
+  QVERIFY((std::is_same_v<
+           reflect::utils::selected_item_t<Type, reflect::StaticMethods,
+                                           decltype(0_c)>,
+           std::decay_t<decltype(boost::hana::at_c<5>(
+               reflect::utils::MetaClass<Type>::metadata))>>));
+}
+
+void MetadataTest::predicate_generators() {
+  using ArithmeticObjVars =
+      reflect::And<reflect::ObjVars, reflect::ByType<std::is_arithmetic>>;
+  QVERIFY((reflect::utils::count<Type, ArithmeticObjVars>()) == 2_c);
+  QVERIFY((reflect::utils::selected_indices_v<
+               Type, reflect::Or<reflect::StaticVars, reflect::ConstMethods>> ==
+           boost::hana::tuple_c<long long, 2, 4>));
+  QVERIFY((reflect::utils::selected_indices_v<Type,
+                                              reflect::Not<reflect::AllVars>> ==
+           boost::hana::tuple_c<long long, 3, 4, 5>));
+  QVERIFY((reflect::utils::selected_indices_v<
+               Type, reflect::ByType<std::is_floating_point>> ==
+           boost::hana::tuple_c<long long, 5>));
+  QVERIFY((reflect::utils::selected_indices_v<Type,
+                                              ArithmeticObjVars::reverse> ==
+           boost::hana::tuple_c<long long, 2, 3, 4, 5>));
+}
+
 QTEST_MAIN(MetadataTest)
 #include "main.moc"
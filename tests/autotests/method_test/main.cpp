@@ -31,6 +31,7 @@ private slots:
   void const_method();
   void constexpr_method();
   void static_method();
+  void noexcept_method();
 };
 
 class Constexpr_class {
@@ -45,6 +46,26 @@ REFLECT_CONST_OBJ_MTD(bool_method)
 REFLECT_OBJ_MTD(fail_method)
 END_METAINFO
 
+class Noexcept_class {
+public:
+  int value{0};
+  int nothrow_method(int arg) noexcept { return value + arg; }
+  int nothrow_method(long arg) { return value + int(arg); }
+  int throw_method() { return value; }
+  int nothrow_const() const noexcept { return value; }
+  int throw_const() const { return value; }
+  static int nothrow_static(int arg) noexcept { return arg; }
+  static int throw_static(int arg) { return arg; }
+  IN_METAINFO(Noexcept_class)
+  REFLECT_OBJ_MTD(nothrow_method, int)
+  REFLECT_OBJ_MTD(nothrow_method, long)
+  REFLECT_OBJ_MTD(throw_method)
+  REFLECT_CONST_OBJ_MTD(nothrow_const)
+  REFLECT_CONST_OBJ_MTD(throw_const)
+  REFLECT_STATIC_MTD(nothrow_static, int)
+  REFLECT_STATIC_MTD(throw_static, int)
+};
+
 void MethodTest::obj_method() {
   value = true;
   value2 = false;
@@ -98,5 +119,38 @@ void MethodTest::static_method() {
   reflect::utils::invoke<Type, reflect::StaticMethods>(0_c, true);
 }
 
+void MethodTest::noexcept_method() {
+  using reflect::utils::invoke;
+  using reflect::utils::is_nothrow_invocable_member;
+  using boost::hana::llong_c;
+  using N = Noexcept_class;
+  N obj;
+  static_assert(noexcept(invoke<N, reflect::AllMethods>(llong_c<0>, obj, 1)));
+  static_assert(
+      !noexcept(invoke<N, reflect::AllMethods>(llong_c<1>, obj, 1l)));
+  static_assert(!noexcept(invoke<N, reflect::AllMethods>(llong_c<2>, obj)));
+  static_assert(noexcept(invoke<N, reflect::ConstMethods>(llong_c<0>, obj)));
+  static_assert(!noexcept(invoke<N, reflect::ConstMethods>(llong_c<1>, obj)));
+  static_assert(noexcept(invoke<N, reflect::StaticMethods>(llong_c<0>, 1)));
+  static_assert(
+      noexcept(invoke<N, reflect::StaticMethods>(llong_c<0>, obj, 1)));
+  static_assert(!noexcept(invoke<N, reflect::StaticMethods>(llong_c<1>, 1)));
+  static_assert(
+      is_nothrow_invocable_member<N, reflect::AllMethods, N &, int>(0_c));
+  static_assert(
+      !is_nothrow_invocable_member<N, reflect::AllMethods, N &, long>(1_c));
+  static_assert(
+      is_nothrow_invocable_member<N, reflect::ConstMethods, const N &>(0_c));
+  static_assert(
+      !is_nothrow_invocable_member<N, reflect::ConstMethods, const N &>(1_c));
+  static_assert(
+      is_nothrow_invocable_member<N, reflect::StaticMethods, int>(0_c));
+  static_assert(
+      !is_nothrow_invocable_member<N, reflect::StaticMethods, int>(1_c));
+  static_assert(
+      !is_nothrow_invocable_member<N, reflect::AllMethods, N &, N &>(0_c));
+  QCOMPARE((invoke<N, reflect::AllMethods>(llong_c<0>, obj, 1)), 1);
+}
+
 QTEST_MAIN(MethodTest)
 #include "main.moc"
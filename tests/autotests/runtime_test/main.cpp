@@ -0,0 +1,176 @@
+#include <QtTest>
+#include <reflect.hpp>
+#include <string>
+
+struct RuntimeParent {
+  int parent_var{7};
+  OUT_METAINFO(RuntimeParent)
+};
+
+METAINFO(RuntimeParent)
+REFLECT_OBJ_VAR(parent_var)
+END_METAINFO
+
+struct RuntimeChild : RuntimeParent {
+  int var{1};
+  const int const_var{2};
+  std::string str{"str"};
+  static int static_var;
+  int foo(int value) { return value; }
+  int foo(int first, int second) const { return first + second; }
+  std::string foo(const std::string &value) { return value + "!"; }
+  long foo(long value) { return value * 2; }
+  static int bar(int value) { return value + 1; }
+  IN_METAINFO(RuntimeChild, RuntimeParent)
+  REFLECT_OBJ_VAR(var)
+  REFLECT_OBJ_VAR(const_var)
+  REFLECT_OBJ_VAR(str)
+  REFLECT_STATIC_VAR(static_var)
+  REFLECT_OBJ_MTD(foo, int)
+  REFLECT_CONST_OBJ_MTD(foo, int, int)
+  REFLECT_OBJ_MTD(foo, const std::string &)
+  REFLECT_OBJ_MTD(foo, long)
+  REFLECT_STATIC_MTD(bar, int)
+};
+
+int RuntimeChild::static_var = 3;
+
+struct RuntimeLayout {
+  char first;
+  double second;
+  IN_METAINFO(RuntimeLayout)
+  REFLECT_OBJ_VAR(first)
+  REFLECT_OBJ_VAR(second)
+};
+
+struct RuntimeLayoutChild : RuntimeParent {
+  IN_METAINFO(RuntimeLayoutChild, RuntimeParent)
+};
+
+class RuntimeConstructed {
+public:
+  explicit RuntimeConstructed(short value) : first{value} {}
+
+private:
+  short first;
+  long second{0};
+
+public:
+  IN_METAINFO(RuntimeConstructed)
+  REFLECT_OBJ_VAR(first)
+  REFLECT_OBJ_VAR(second)
+};
+
+class RuntimeTest : public QObject {
+  Q_OBJECT
+private slots:
+  void descriptors();
+  void find();
+  void get_set();
+  void offsets();
+  void invoke_by_name();
+};
+
+void RuntimeTest::descriptors() {
+  using reflect::runtime::MemberInfo;
+  const auto &object = reflect::runtime::meta_object<RuntimeChild>();
+  QCOMPARE(object.name(), std::string_view("RuntimeChild"));
+  QCOMPARE(object.size(), std::size_t{10});
+  QCOMPARE(object[0].name, std::string_view("var"));
+  QCOMPARE(object[9].name, std::string_view("parent_var"));
+  QVERIFY(object[0].is(MemberInfo::Variable) &&
+          object[0].is(MemberInfo::Object));
+  QVERIFY(object[1].is(MemberInfo::Const) && !object[1].set);
+  QVERIFY(object[3].is(MemberInfo::Static));
+  QVERIFY(object[4].is(MemberInfo::Method) && !object[4].get);
+  QVERIFY(object[5].is(MemberInfo::Const));
+  QCOMPARE(object[4].next, std::uint32_t{5});
+  QCOMPARE(object[7].next, MemberInfo::npos);
+  QVERIFY(object[2].type == reflect::runtime::type_id_v<std::string>);
+  QVERIFY(object[4].type == reflect::runtime::type_id_v<int>);
+  QVERIFY(&object == &reflect::runtime::meta_object<RuntimeChild>());
+}
+
+void RuntimeTest::find() {
+  const auto &object = reflect::runtime::meta_object<RuntimeChild>();
+  QCOMPARE(object.index_of("var"), std::size_t{0});
+  QCOMPARE(object.index_of("static_var"), std::size_t{3});
+  QCOMPARE(object.index_of("foo"), std::size_t{4});
+  QCOMPARE(object.index_of("parent_var"), std::size_t{9});
+  QCOMPARE(object.index_of("nothing"), reflect::runtime::MetaObject::npos);
+  QCOMPARE(object.index_of("va"), reflect::runtime::MetaObject::npos);
+  QVERIFY(object.find("nothing") == nullptr);
+}
+
+void RuntimeTest::get_set() {
+  const auto &object = reflect::runtime::meta_object<RuntimeChild>();
+  RuntimeChild child;
+  int value = 0;
+  std::string str;
+  QVERIFY(object.get(child, "var", value) && value == 1);
+  QVERIFY(object.get(child, "parent_var", value) && value == 7);
+  QVERIFY(object.get(child, "static_var", value) && value == 3);
+  QVERIFY(object.get(child, "str", str) && str == "str");
+  QVERIFY(!object.get(child, "str", value));
+  QVERIFY(!object.get(child, "foo", value));
+  QVERIFY(object.set(child, "var", 11) && child.var == 11);
+  QVERIFY(object.set(child, "str", std::string("new")) && child.str == "new");
+  QVERIFY(!object.set(child, "const_var", 12));
+  QVERIFY(!object.set(child, "var", 1.0));
+}
+
+void RuntimeTest::offsets() {
+  const auto &object = reflect::runtime::meta_object<RuntimeLayout>();
+  QCOMPARE(object[0].offset, std::ptrdiff_t(offsetof(RuntimeLayout, first)));
+  QCOMPARE(object[1].offset, std::ptrdiff_t(offsetof(RuntimeLayout, second)));
+  QCOMPARE(reflect::runtime::meta_object<RuntimeChild>()[0].offset,
+           reflect::runtime::MemberInfo::no_offset);
+  QCOMPARE(reflect::runtime::meta_object<RuntimeParent>()[0].offset,
+           std::ptrdiff_t(offsetof(RuntimeParent, parent_var)));
+  QCOMPARE(reflect::runtime::meta_object<RuntimeLayoutChild>()[0].offset,
+           std::ptrdiff_t(offsetof(RuntimeParent, parent_var)));
+  const auto &constructed =
+      reflect::runtime::meta_object<RuntimeConstructed>();
+  QCOMPARE(constructed[0].offset, std::ptrdiff_t(0));
+  QVERIFY(constructed[1].offset > constructed[0].offset);
+  QCOMPARE(constructed[1].offset % std::ptrdiff_t(alignof(long)),
+           std::ptrdiff_t(0));
+}
+
+void RuntimeTest::invoke_by_name() {
+  using reflect::runtime::InvokeError;
+  RuntimeChild child;
+  const RuntimeChild &const_child = child;
+  auto by_int = reflect::runtime::invoke_by_name<RuntimeChild, int>(
+      child, "foo", 5);
+  QVERIFY(by_int && by_int.value() == 5);
+  auto by_long = reflect::runtime::invoke_by_name<RuntimeChild, long>(
+      child, "foo", 5l);
+  QVERIFY(by_long && by_long.value() == 10);
+  auto by_string = reflect::runtime::invoke_by_name<RuntimeChild, std::string>(
+      child, "foo", "str");
+  QVERIFY(by_string && by_string.value() == "str!");
+  auto by_const = reflect::runtime::invoke_by_name<RuntimeChild, int>(
+      const_child, "foo", 1, 2);
+  QVERIFY(by_const && by_const.value() == 3);
+  auto by_static = reflect::runtime::invoke_by_name<RuntimeChild, int>(
+      child, "bar", 1);
+  QVERIFY(by_static && by_static.value() == 2);
+  auto by_var = reflect::runtime::invoke_by_name<RuntimeChild, int>(
+      child, "parent_var");
+  QVERIFY(by_var && by_var.value() == 7);
+  QCOMPARE((reflect::runtime::invoke_by_name<RuntimeChild>(child, "nothing")
+                .error()),
+           InvokeError::NotFound);
+  QCOMPARE((reflect::runtime::invoke_by_name<RuntimeChild>(const_child, "foo",
+                                                           1)
+                .error()),
+           InvokeError::NoMatchingOverload);
+  QCOMPARE((reflect::runtime::invoke_by_name<RuntimeChild, std::string>(
+                child, "foo", 1)
+                .error()),
+           InvokeError::NoMatchingOverload);
+}
+
+QTEST_MAIN(RuntimeTest)
+#include "main.moc"
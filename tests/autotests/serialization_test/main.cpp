@@ -0,0 +1,622 @@
+#include <QtTest>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory_resource>
+#include <sstream>
+#include <reflect.hpp>
+#include <string>
+#include <vector>
+
+struct SerializationPoint {
+  int x{0};
+  int y{0};
+  int z{0};
+  IN_METAINFO(SerializationPoint)
+  REFLECT_OBJ_VAR(x)
+  REFLECT_OBJ_VAR(y)
+  REFLECT_OBJ_VAR(z)
+};
+
+struct SerializationParent {
+  short parent_var{0};
+  std::string parent_str;
+  OUT_METAINFO(SerializationParent)
+};
+
+METAINFO(SerializationParent)
+REFLECT_OBJ_VAR(parent_var)
+REFLECT_OBJ_VAR(parent_str)
+END_METAINFO
+
+struct SerializationChild : SerializationParent {
+  char tag{0};
+  double value{0};
+  std::string name;
+  std::vector<int> numbers;
+  std::vector<std::string> words;
+  std::vector<SerializationPoint> points;
+  static int static_var;
+  IN_METAINFO(SerializationChild, SerializationParent)
+  REFLECT_OBJ_VAR(tag)
+  REFLECT_OBJ_VAR(value)
+  REFLECT_OBJ_VAR(name)
+  REFLECT_STATIC_VAR(static_var)
+  REFLECT_OBJ_VAR(numbers)
+  REFLECT_OBJ_VAR(words)
+  REFLECT_OBJ_VAR(points)
+};
+
+int SerializationChild::static_var = 0;
+
+struct SerializationEmpty {
+  static int static_var;
+  int get() const { return static_var; }
+  IN_METAINFO(SerializationEmpty)
+  REFLECT_STATIC_VAR(static_var)
+  REFLECT_CONST_OBJ_MTD(get)
+};
+
+int SerializationEmpty::static_var = 0;
+
+struct SerializationBorrowed {
+  int id{0};
+  std::string_view name;
+  std::vector<std::string_view> words;
+  OUT_METAINFO(SerializationBorrowed)
+};
+
+METAINFO(SerializationBorrowed)
+REFLECT_OBJ_VAR(id)
+REFLECT_OBJ_VAR(name)
+REFLECT_OBJ_VAR(words)
+END_METAINFO
+
+struct SerializationBorrowedChild : SerializationBorrowed {
+  int value{0};
+  IN_METAINFO(SerializationBorrowedChild, SerializationBorrowed)
+  REFLECT_OBJ_VAR(value)
+};
+
+struct SerializationArenaItem {
+  std::pmr::string name;
+  std::pmr::vector<int> values;
+  IN_METAINFO(SerializationArenaItem)
+  REFLECT_OBJ_VAR(name)
+  REFLECT_OBJ_VAR(values)
+};
+
+struct SerializationArena {
+  int id{0};
+  std::pmr::string name;
+  std::pmr::vector<std::pmr::string> words;
+  std::pmr::vector<SerializationArenaItem> items;
+  IN_METAINFO(SerializationArena)
+  REFLECT_OBJ_VAR(id)
+  REFLECT_OBJ_VAR(name)
+  REFLECT_OBJ_VAR(words)
+  REFLECT_OBJ_VAR(items)
+};
+
+namespace serialization_test {
+
+enum class Level : unsigned char { debug, info, error = 10 };
+
+enum class Access { none = 0, read = 1, write = 2 };
+
+enum class Raw { first, second };
+} // namespace serialization_test
+
+REFLECT_ENUM(serialization_test::Level, debug, info, error)
+REFLECT_FLAGS(serialization_test::Access, none, read, write)
+
+struct SerializationEnums {
+  serialization_test::Level level{serialization_test::Level::debug};
+  serialization_test::Access access{serialization_test::Access::none};
+  serialization_test::Raw raw{serialization_test::Raw::first};
+  std::vector<serialization_test::Level> levels;
+  IN_METAINFO(SerializationEnums)
+  REFLECT_OBJ_VAR(level)
+  REFLECT_OBJ_VAR(access)
+  REFLECT_OBJ_VAR(raw)
+  REFLECT_OBJ_VAR(levels)
+};
+
+class SerializationTest : public QObject {
+  Q_OBJECT
+private slots:
+  void binary_bytes();
+  void binary_round_trip();
+  void binary_invalid();
+  void binary_delta();
+  void json_write();
+  void json_read();
+  void json_enum();
+  void json_stream();
+  void borrowed();
+  void arena();
+};
+
+void SerializationTest::binary_bytes() {
+  SerializationPoint point{1, 2, 3};
+  std::string bytes = reflect::binary::serialize(point);
+  QCOMPARE(bytes.size(), 3 * sizeof(int));
+  QCOMPARE(bytes, std::string(reinterpret_cast<const char *>(&point),
+                              3 * sizeof(int)));
+
+  SerializationChild child;
+  child.parent_var = 5;
+  child.tag = 'a';
+  child.value = 0.5;
+  // padding between tag and value isn't written
+  bytes = reflect::binary::serialize(child);
+  QCOMPARE(bytes.size(), sizeof(short) + 5 * sizeof(std::uint64_t) +
+                             sizeof(char) + sizeof(double));
+  short parent_var = 0;
+  std::memcpy(&parent_var, bytes.data(), sizeof(short));
+  QCOMPARE(parent_var, short{5});
+  QCOMPARE(bytes[sizeof(short) + sizeof(std::uint64_t)], 'a');
+}
+
+void SerializationTest::binary_round_trip() {
+  SerializationChild child;
+  child.parent_var = 5;
+  child.parent_str = "parent";
+  child.tag = 'a';
+  child.value = 0.5;
+  child.name = "child";
+  child.numbers = {1, 2, 3};
+  child.words = {"first", "", "third"};
+  child.points = {{1, 2, 3}, {4, 5, 6}};
+  std::string bytes;
+  reflect::binary::serialize(child, bytes);
+
+  SerializationChild result;
+  QVERIFY(reflect::binary::deserialize(bytes, result));
+  QCOMPARE(result.parent_var, short{5});
+  QCOMPARE(result.parent_str, std::string("parent"));
+  QCOMPARE(result.tag, 'a');
+  QCOMPARE(result.value, 0.5);
+  QCOMPARE(result.name, std::string("child"));
+  QCOMPARE(result.numbers, (std::vector<int>{1, 2, 3}));
+  QCOMPARE(result.words, (std::vector<std::string>{"first", "", "third"}));
+  QCOMPARE(result.points.size(), std::size_t{2});
+  QCOMPARE(result.points[1].z, 6);
+
+  reflect::binary::serialize(SerializationPoint{7, 8, 9}, bytes);
+  reflect::binary::Reader reader(bytes);
+  SerializationPoint point;
+  QVERIFY(reflect::binary::deserialize(reader, result));
+  QVERIFY(reflect::binary::deserialize(reader, point));
+  QCOMPARE(reader.remaining(), std::size_t{0});
+  QCOMPARE(point.y, 8);
+
+  std::vector<SerializationEmpty> empties(3);
+  bytes = reflect::binary::serialize(empties);
+  QCOMPARE(bytes.size(), sizeof(reflect::binary::size_type));
+  std::vector<SerializationEmpty> empties_result;
+  QVERIFY(reflect::binary::deserialize(bytes, empties_result));
+  QCOMPARE(empties_result.size(), std::size_t{3});
+  bytes = reflect::binary::serialize(reflect::binary::max_empty_elements + 1);
+  QVERIFY(!reflect::binary::deserialize(bytes, empties_result));
+  bytes = reflect::binary::serialize(std::uint64_t{1} << 40);
+  QVERIFY(!reflect::binary::deserialize(bytes, empties_result));
+}
+
+void SerializationTest::binary_invalid() {
+  SerializationChild child;
+  child.words = {"first", "second"};
+  std::string bytes = reflect::binary::serialize(child);
+  SerializationChild result;
+  for (std::size_t size = 0; size < bytes.size(); ++size)
+    QVERIFY(!reflect::binary::deserialize(
+        std::string_view(bytes.data(), size), result));
+  QVERIFY(!reflect::binary::deserialize(bytes + 'x', result));
+
+  std::vector<int> numbers;
+  std::string huge = reflect::binary::serialize(std::uint64_t{1} << 60);
+  QVERIFY(!reflect::binary::deserialize(huge, numbers));
+  QVERIFY(numbers.empty());
+}
+
+void SerializationTest::binary_delta() {
+  SerializationChild baseline;
+  baseline.parent_str = "parent";
+  baseline.name = "child";
+  baseline.points = {{1, 2, 3}};
+  SerializationChild current = baseline;
+  QCOMPARE(reflect::binary::serialize_delta(baseline, current),
+           std::string(sizeof(std::uint64_t), '\0'));
+
+  current.value = 1.5;
+  current.parent_str = "changed";
+  current.points[0].y = 5;
+  std::string bytes = reflect::binary::serialize_delta(baseline, current);
+  QCOMPARE(bytes.size(), sizeof(std::uint64_t) + sizeof(double) +
+                             2 * sizeof(std::uint64_t) + 3 * sizeof(int) +
+                             std::string("changed").size());
+  QCOMPARE(reflect::binary::delta_names<SerializationChild>(bytes),
+           (std::vector<std::string_view>{"value", "points", "parent_str"}));
+
+  SerializationChild patched = baseline;
+  QVERIFY(reflect::binary::deserialize_delta(bytes, patched));
+  QVERIFY(reflect::utils::equal<SerializationChild>{}(patched, current));
+  QCOMPARE(patched.name, std::string("child"));
+
+  for (std::size_t size = 0; size < bytes.size(); ++size) {
+    SerializationChild result = baseline;
+    QVERIFY(!reflect::binary::deserialize_delta(
+        std::string_view(bytes.data(), size), result));
+  }
+  QVERIFY(!reflect::binary::deserialize_delta(bytes + 'x', patched));
+  // bits after last object variable must be zero
+  std::string invalid = bytes;
+  invalid[sizeof(std::uint64_t) - 1] = 1;
+  QVERIFY(!reflect::binary::deserialize_delta(invalid, patched));
+  QVERIFY(reflect::binary::delta_names<SerializationChild>(invalid).empty());
+
+  reflect::utils::member_mask_t<SerializationPoint> mask;
+  mask.set(2);
+  bytes.clear();
+  reflect::binary::serialize_delta(SerializationPoint{1, 2, 3}, mask, bytes);
+  SerializationPoint point;
+  QVERIFY(reflect::binary::deserialize_delta(bytes, point));
+  QCOMPARE(point.x, 0);
+  QCOMPARE(point.z, 3);
+}
+
+void SerializationTest::json_write() {
+  SerializationChild child;
+  child.parent_var = -5;
+  child.parent_str = "quote \" backslash \\ tab \t\x01 long enough string";
+  child.tag = '\n';
+  child.value = 0.1;
+  child.name = "child";
+  child.numbers = {1, 2, 3};
+  child.words = {"first", ""};
+  child.points = {{1, 2, 3}};
+  QCOMPARE(reflect::json::write(child),
+           std::string(
+               "{\"tag\":\"\\n\",\"value\":0.1,\"name\":\"child\","
+               "\"numbers\":[1,2,3],\"words\":[\"first\",\"\"],"
+               "\"points\":[{\"x\":1,\"y\":2,\"z\":3}],"
+               "\"parent_var\":-5,\"parent_str\":\"quote \\\" backslash "
+               "\\\\ tab \\t\\u0001 long enough string\"}"));
+
+  std::string buffer = "[";
+  reflect::json::write(std::vector<double>{1.5, -0.0, 1e300}, buffer);
+  reflect::json::write(std::numeric_limits<double>::infinity(), buffer);
+  reflect::json::write(true, buffer);
+  QCOMPARE(buffer, std::string("[[1.5,-0,1e+300]nulltrue"));
+  QCOMPARE(reflect::json::write(std::vector<int>{}), std::string("[]"));
+}
+
+void SerializationTest::json_read() {
+  SerializationChild child;
+  child.parent_var = -5;
+  child.parent_str = "quote \" backslash \\ tab \t\x01 long enough string";
+  child.tag = '\n';
+  child.value = 0.1;
+  child.name = "child";
+  child.numbers = {1, 2, 3};
+  child.words = {"first", ""};
+  child.points = {{1, 2, 3}, {4, 5, 6}};
+  auto result = reflect::json::read<SerializationChild>(
+      reflect::json::write(child));
+  QVERIFY(result);
+  QCOMPARE(result->parent_var, short{-5});
+  QCOMPARE(result->parent_str, child.parent_str);
+  QCOMPARE(result->tag, '\n');
+  QCOMPARE(result->value, 0.1);
+  QCOMPARE(result->name, std::string("child"));
+  QCOMPARE(result->numbers, child.numbers);
+  QCOMPARE(result->words, child.words);
+  QCOMPARE(result->points.size(), std::size_t{2});
+  QCOMPARE(result->points[1].y, 5);
+
+  SerializationPoint point{7, 8, 9};
+  QVERIFY(reflect::json::read(
+      " { \"unknown\" : {\"a\": [1, \"]}\\\"\", {}]}, \"y\" : -1,"
+      " \"other\": \"\\\\\", \"z\":2, \"flag\": true, \"none\": null } ",
+      point));
+  QCOMPARE(point.x, 7);
+  QCOMPARE(point.y, -1);
+  QCOMPARE(point.z, 2);
+
+  std::string str;
+  QVERIFY(reflect::json::read("\"\\u00e9\\ud83d\\ude00\\/\"", str));
+  QCOMPARE(str, std::string("\xc3\xa9\xf0\x9f\x98\x80/"));
+  std::vector<double> values;
+  QVERIFY(reflect::json::read("[1.5, -0, 1e300, null]", values));
+  QCOMPARE(values.size(), std::size_t{4});
+  QVERIFY(std::isnan(values[3]));
+  std::vector<bool> flags;
+  QVERIFY(reflect::json::read("[true,false]", flags));
+  QCOMPARE(flags, (std::vector<bool>{true, false}));
+
+  QVERIFY(!reflect::json::read("{\"x\":1", point));
+  QVERIFY(!reflect::json::read("{\"x\":1.5}", point));
+  QVERIFY(!reflect::json::read("{\"x\":\"1\"}", point));
+  QVERIFY(!reflect::json::read("{\"x\":1} x", point));
+  QVERIFY(!reflect::json::read("{\"x\":1,}", point));
+  QVERIFY(!reflect::json::read("\"\\ud83d\"", str));
+  QVERIFY(!reflect::json::read("\"\\q\"", str));
+  QVERIFY(!reflect::json::read("\"unterminated", str));
+  QVERIFY(!reflect::json::read("[1,2", values));
+  QVERIFY(!reflect::json::read<SerializationPoint>("{\"a\":[1,2}"));
+  for (const char *invalid :
+       {"[inf]", "[nan]", "[-inf]", "[01]", "[-01]", "[1.]", "[.5]", "[1e]",
+        "[+1]", "[0x10]", "[1e+]", "[-]"})
+    QVERIFY(!reflect::json::read(invalid, values));
+  QVERIFY(reflect::json::read("[0, -0.5, 2E-3, 1e+2]", values));
+  QCOMPARE(values, (std::vector<double>{0, -0.5, 2e-3, 100}));
+  for (const char *invalid :
+       {"{\"a\":nan}", "{\"a\":inf}", "{\"a\":01}", "{\"a\":truex}",
+        "{\"a\":x}", "{\"a\":0x1}"})
+    QVERIFY(!reflect::json::read(invalid, point));
+  for (const char *invalid :
+       {"{\"a\":[}}", "{\"a\":{abc}}", "{\"a\":[1 2]}", "{\"a\":{\"b\" 1}}",
+        "{\"a\":{1:2}}", "{\"a\":[1,]}", "{\"a\":[,1]}", "{\"a\":{\"b\":1,}}",
+        "{\"a\":{\"b\"}}", "{\"a\":[[1]}", "{\"a\":[1]]}", "{\"a\":[x]}"})
+    QVERIFY(!reflect::json::read(invalid, point));
+  QVERIFY(reflect::json::read(
+      "{\"a\":[ ],\"b\":{ },\"c\":[[1,{\"d\":[null,\"}]\"]}],{}],\"x\":4}",
+      point));
+  QCOMPARE(point.x, 4);
+  QVERIFY(reflect::json::read("{\"a\":-1.5e3,\"b\":false,\"x\":3}", point));
+  QCOMPARE(point.x, 3);
+}
+
+void SerializationTest::json_enum() {
+  using serialization_test::Access;
+  using serialization_test::Level;
+  using serialization_test::Raw;
+  SerializationEnums enums;
+  enums.level = Level::error;
+  enums.access = static_cast<Access>(3);
+  enums.raw = Raw::second;
+  enums.levels = {Level::info, static_cast<Level>(5)};
+  const std::string json = reflect::json::write(enums);
+  QCOMPARE(json, std::string("{\"level\":\"error\",\"access\":\"read|write\","
+                             "\"raw\":1,\"levels\":[\"info\",5]}"));
+  auto result = reflect::json::read<SerializationEnums>(json);
+  QVERIFY(result);
+  QCOMPARE(result->level, Level::error);
+  QCOMPARE(result->access, static_cast<Access>(3));
+  QCOMPARE(result->raw, Raw::second);
+  QCOMPARE(result->levels, enums.levels);
+
+  enums.access = static_cast<Access>(4);
+  QCOMPARE(reflect::json::write(enums.access), std::string("4"));
+  QVERIFY(reflect::json::read(" \"write | read\" ", enums.access));
+  QCOMPARE(enums.access, static_cast<Access>(3));
+  QVERIFY(reflect::json::read("10", enums.level));
+  QCOMPARE(enums.level, Level::error);
+  QVERIFY(!reflect::json::read("\"warning\"", enums.level));
+  QVERIFY(!reflect::json::read("\"read|\"", enums.access));
+  QVERIFY(!reflect::json::read("\"second\"", enums.raw));
+
+  SerializationEnums copy;
+  QVERIFY(reflect::binary::deserialize(reflect::binary::serialize(enums),
+                                       copy));
+  QCOMPARE(copy.level, Level::error);
+  QCOMPARE(copy.access, static_cast<Access>(3));
+  QCOMPARE(copy.levels, enums.levels);
+}
+
+void SerializationTest::json_stream() {
+  std::vector<SerializationChild> children(100);
+  for (std::size_t i = 0; i < children.size(); ++i) {
+    children[i].parent_var = static_cast<short>(i);
+    children[i].name = std::string(i, 'n');
+    children[i].numbers.assign(i % 5, static_cast<int>(i));
+  }
+  const std::string json = " \n" + reflect::json::write(children) + " ";
+  auto chunks = [&json, position = std::size_t{0}](
+                    char *data, std::size_t size) mutable {
+    size = std::min({size, std::size_t{7}, json.size() - position});
+    std::memcpy(data, json.data() + position, size);
+    position += size;
+    return size;
+  };
+
+  auto reader = reflect::json::array_reader<SerializationChild>(chunks, 16);
+  SerializationChild child;
+  std::size_t count = 0;
+  while (reader.next(child)) {
+    QCOMPARE(child.parent_var, static_cast<short>(count));
+    QCOMPARE(child.name, std::string(count, 'n'));
+    QCOMPARE(child.numbers, children[count].numbers);
+    ++count;
+  }
+  QCOMPARE(count, children.size());
+  QVERIFY(reader.finished() && !reader.failed());
+  QVERIFY(!reader.next(child));
+
+  auto batch_reader = reflect::json::array_reader<SerializationChild>(chunks);
+  std::vector<SerializationChild> batch;
+  QCOMPARE(batch_reader.next(batch, 64), std::size_t{64});
+  QCOMPARE(batch[63].name, std::string(63, 'n'));
+  QCOMPARE(batch_reader.next(batch, 64), std::size_t{36});
+  QCOMPARE(batch[35].parent_var, short{99});
+  QCOMPARE(batch_reader.next(batch, 64), std::size_t{0});
+  QVERIFY(batch_reader.finished());
+
+  std::istringstream stream(json);
+  reflect::json::ArrayReader<SerializationChild, reflect::json::StreamSource>
+      stream_reader{reflect::json::StreamSource(stream), 1};
+  QCOMPARE(stream_reader.next(batch, 1000), children.size());
+  QCOMPARE(batch.back().numbers, children.back().numbers);
+  QVERIFY(stream_reader.finished());
+
+  std::istringstream numbers_stream("[1, 22,333 ,\n4444]");
+  reflect::json::ArrayReader<long long, reflect::json::StreamSource>
+      numbers_reader{reflect::json::StreamSource(numbers_stream), 2};
+  std::vector<long long> numbers;
+  QCOMPARE(numbers_reader.next(numbers, 10), std::size_t{4});
+  QCOMPARE(numbers, (std::vector<long long>{1, 22, 333, 4444}));
+
+  for (std::size_t chunk = 1; chunk <= 3; ++chunk) {
+    std::istringstream integers_stream("[-1,-22,-333]");
+    reflect::json::ArrayReader<long long, reflect::json::StreamSource>
+        integers_reader{reflect::json::StreamSource(integers_stream), chunk};
+    QCOMPARE(integers_reader.next(numbers, 10), std::size_t{3});
+    QCOMPARE(numbers, (std::vector<long long>{-1, -22, -333}));
+    QVERIFY(integers_reader.finished());
+
+    std::istringstream doubles_stream("[1.5,2.25e3,-0.5E-1,7]");
+    reflect::json::ArrayReader<double, reflect::json::StreamSource>
+        doubles_reader{reflect::json::StreamSource(doubles_stream), chunk};
+    std::vector<double> doubles;
+    QCOMPARE(doubles_reader.next(doubles, 10), std::size_t{4});
+    QCOMPARE(doubles, (std::vector<double>{1.5, 2250, -0.05, 7}));
+    QVERIFY(doubles_reader.finished());
+
+    std::istringstream nulls_stream("[null,1,null]");
+    reflect::json::ArrayReader<double, reflect::json::StreamSource>
+        nulls_reader{reflect::json::StreamSource(nulls_stream), chunk};
+    QCOMPARE(nulls_reader.next(doubles, 10), std::size_t{3});
+    QVERIFY(std::isnan(doubles[0]) && std::isnan(doubles[2]));
+    QVERIFY(nulls_reader.finished());
+
+    std::istringstream flags_stream("[true,false,true]");
+    reflect::json::ArrayReader<bool, reflect::json::StreamSource>
+        flags_reader{reflect::json::StreamSource(flags_stream), chunk};
+    std::vector<bool> flags;
+    for (bool flag = false; flags_reader.next(flag);)
+      flags.push_back(flag);
+    QCOMPARE(flags, (std::vector<bool>{true, false, true}));
+    QVERIFY(flags_reader.finished());
+
+    for (const char *invalid : {"[-]", "[1.]", "[2e]", "[tru]", "[-x]"}) {
+      std::istringstream invalid_stream(invalid);
+      reflect::json::ArrayReader<double, reflect::json::StreamSource>
+          invalid_reader{reflect::json::StreamSource(invalid_stream), chunk};
+      QCOMPARE(invalid_reader.next(doubles, 10), std::size_t{0});
+      QVERIFY(invalid_reader.failed());
+    }
+  }
+
+  std::istringstream points_stream(
+      R"([{"x":1,"y":2,"z":3},{"x":4},{"z":5}])");
+  reflect::json::ArrayReader<SerializationPoint, reflect::json::StreamSource>
+      points_reader{reflect::json::StreamSource(points_stream), 4};
+  SerializationPoint point;
+  QVERIFY(points_reader.next(point));
+  QVERIFY(points_reader.next(point));
+  QCOMPARE(point.x, 4);
+  QCOMPARE(point.y, 0);
+  QCOMPARE(point.z, 0);
+  std::vector<SerializationPoint> points{{7, 7, 7}};
+  QCOMPARE(points_reader.next(points, 10), std::size_t{1});
+  QCOMPARE(points[0].x, 0);
+  QCOMPARE(points[0].y, 0);
+  QCOMPARE(points[0].z, 5);
+
+  for (const char *invalid : {"", "{}", "[1,]", "[1 2]", "[1", "[\"a"}) {
+    std::istringstream invalid_stream(invalid);
+    reflect::json::ArrayReader<long long, reflect::json::StreamSource>
+        invalid_reader{reflect::json::StreamSource(invalid_stream), 1};
+    QVERIFY(invalid_reader.next(numbers, 10) <= 1);
+    QVERIFY(invalid_reader.failed());
+  }
+}
+
+void SerializationTest::borrowed() {
+  static_assert(reflect::utils::is_borrowing_v<SerializationBorrowed>);
+  static_assert(reflect::utils::is_borrowing_v<SerializationBorrowedChild>);
+  static_assert(
+      reflect::utils::is_borrowing_v<std::vector<SerializationBorrowed>>);
+  static_assert(!reflect::utils::is_borrowing_v<SerializationChild>);
+  static_assert(!reflect::utils::is_borrowing_v<std::string>);
+
+  auto inside = [](std::string_view view, const std::string &input) {
+    return view.data() >= input.data() &&
+           view.data() + view.size() <= input.data() + input.size();
+  };
+  SerializationBorrowedChild child;
+  child.id = 1;
+  child.name = "name";
+  child.words = {"first", "", "third"};
+  child.value = 2;
+  const std::string bytes = reflect::binary::serialize(child);
+  SerializationBorrowedChild result;
+  QVERIFY(reflect::binary::deserialize(bytes, result));
+  QCOMPARE(result.name, std::string_view("name"));
+  QVERIFY(inside(result.name, bytes));
+  QCOMPARE(result.words.size(), std::size_t{3});
+  QVERIFY(inside(result.words[2], bytes));
+  QCOMPARE(result.words[2], std::string_view("third"));
+  QCOMPARE(result.value, 2);
+  std::string chars;
+  QVERIFY(reflect::binary::deserialize(reflect::binary::serialize(child.name),
+                                       chars));
+  QCOMPARE(chars, std::string("name"));
+
+  const std::string json = reflect::json::write(child);
+  result = SerializationBorrowedChild{};
+  QVERIFY(reflect::json::read(json, result));
+  QCOMPARE(result.name, std::string_view("name"));
+  QVERIFY(inside(result.name, json));
+  QCOMPARE(result.words[0], std::string_view("first"));
+  QVERIFY(inside(result.words[0], json));
+
+  std::string escaped = "{\"name\":\"line\\none \\u00e9\",\"words\":[\"a\\\"b\"]}";
+  QVERIFY(!reflect::json::read(escaped, result));
+  QVERIFY(reflect::json::read_insitu(escaped, result));
+  QCOMPARE(result.name, std::string_view("line\none \xc3\xa9"));
+  QVERIFY(inside(result.name, escaped));
+  QCOMPARE(result.words[0], std::string_view("a\"b"));
+}
+
+void SerializationTest::arena() {
+  SerializationArena message;
+  message.id = 1;
+  message.name = "message name longer than small string buffer";
+  message.words = {"first word longer than small string buffer", "second"};
+  message.items.resize(2);
+  message.items[1].name = "item name longer than small string buffer";
+  message.items[1].values = {1, 2, 3};
+  const std::string bytes = reflect::binary::serialize(message);
+  const std::string json = reflect::json::write(message);
+
+  auto check = [&message](const SerializationArena &result,
+                          std::pmr::memory_resource *arena) {
+    QCOMPARE(result.name, message.name);
+    QCOMPARE(result.words, message.words);
+    QCOMPARE(result.items[1].name, message.items[1].name);
+    QCOMPARE(result.items[1].values, message.items[1].values);
+    QVERIFY(result.name.get_allocator().resource() == arena);
+    QVERIFY(result.words.get_allocator().resource() == arena);
+    QVERIFY(result.words[0].get_allocator().resource() == arena);
+    QVERIFY(result.items.get_allocator().resource() == arena);
+    QVERIFY(result.items[1].name.get_allocator().resource() == arena);
+    QVERIFY(result.items[1].values.get_allocator().resource() == arena);
+  };
+
+  // any allocation outside of arena throws std::bad_alloc
+  std::pmr::memory_resource *default_resource =
+      std::pmr::set_default_resource(std::pmr::null_memory_resource());
+  alignas(std::max_align_t) char buffer[4096];
+  {
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                              std::pmr::null_memory_resource());
+    SerializationArena result;
+    QVERIFY(reflect::binary::deserialize(bytes, result, &arena));
+    check(result, &arena);
+    QVERIFY(reflect::binary::deserialize(bytes, result, &arena));
+    check(result, &arena);
+  }
+  {
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                              std::pmr::null_memory_resource());
+    SerializationArena result;
+    QVERIFY(reflect::json::read(json, result, &arena));
+    check(result, &arena);
+  }
+  std::pmr::set_default_resource(default_resource);
+}
+
+QTEST_MAIN(SerializationTest)
+#include "main.moc"
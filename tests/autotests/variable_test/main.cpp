@@ -23,6 +23,9 @@ private slots:
   void set_obj_variable();
   void set_static_variable();
   void set_variable();
+  void get_set_function();
+  void visit_variable();
+  void noexcept_variable();
 };
 
 int VariableTest::static_var = 3;
@@ -62,5 +65,60 @@ void VariableTest::set_variable() {
   QCOMPARE((reflect::utils::invoke<Type, reflect::AllVars>(2_c, *this)), 14);
 }
 
+void VariableTest::get_set_function() {
+  var = 1;
+  int &result = reflect::utils::set<Type, reflect::ObjVars>(0_c, 16, *this);
+  QCOMPARE(&result, &var);
+  QCOMPARE(var, 16);
+  QCOMPARE((reflect::utils::get<Type, reflect::ObjVars>(1_c, *this)), 2);
+  reflect::utils::set<Type, reflect::StaticVars>(0_c, 17);
+  QCOMPARE((reflect::utils::get<Type, reflect::StaticVars>(0_c)), 17);
+  QVERIFY(!(decltype(reflect::utils::check_set<Type, reflect::ObjVars, int,
+                                                Type &>(1_c))::value));
+}
+
+void VariableTest::visit_variable() {
+  var = 1;
+  static_var = 3;
+  auto get = [](auto &&index, auto &&obj) -> int {
+    return reflect::utils::invoke<Type, reflect::AllVars>(index, obj);
+  };
+  for (std::size_t i = 0; i < 3; ++i)
+    QCOMPARE((reflect::utils::visit_member<Type, reflect::AllVars>(*this, i,
+                                                                    get)),
+             int(i) + 1);
+  reflect::utils::visit_member<Type, reflect::StaticVars>(
+      *this, 0, [](auto &&index, auto &&obj) {
+        reflect::utils::invoke<Type, reflect::StaticVars>(index, obj) = 15;
+      });
+  QCOMPARE(static_var, 15);
+  constexpr long long index = reflect::utils::visit_member<Type>(
+      0, 2, [](auto &&index, int) { return index.value; });
+  QCOMPARE(index, 2ll);
+}
+
+void VariableTest::noexcept_variable() {
+  using reflect::utils::invoke;
+  using reflect::utils::is_nothrow_invocable_member;
+  using boost::hana::llong_c;
+  static_assert(noexcept(
+      invoke<Type, reflect::ObjVars>(llong_c<0>, std::declval<Type &>())));
+  static_assert(noexcept(invoke<Type, reflect::ObjVars>(
+      llong_c<1>, std::declval<const Type &>())));
+  static_assert(noexcept(invoke<Type, reflect::StaticVars>(llong_c<0>)));
+  static_assert(noexcept(
+      invoke<Type, reflect::StaticVars>(llong_c<0>, std::declval<Type &>())));
+  static_assert(noexcept(reflect::utils::get<Type, reflect::ObjVars>(
+      llong_c<0>, std::declval<Type &>())));
+  static_assert(noexcept(reflect::utils::set<Type, reflect::ObjVars>(
+      llong_c<0>, 1, std::declval<Type &>())));
+  static_assert(
+      is_nothrow_invocable_member<Type, reflect::ObjVars, Type &>(0_c));
+  static_assert(is_nothrow_invocable_member<Type, reflect::StaticVars>(0_c));
+  static_assert(!is_nothrow_invocable_member<Type, reflect::ObjVars, int>(0_c));
+  var = 1;
+  QCOMPARE((invoke<Type, reflect::ObjVars>(llong_c<0>, *this)), 1);
+}
+
 QTEST_MAIN(VariableTest)
 #include "main.moc"
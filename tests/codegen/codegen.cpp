@@ -0,0 +1,71 @@
+#include <reflect.hpp>
+#include <type_traits>
+
+namespace hana = boost::hana;
+using Gen = reflect::info::DefaultIndexGenerator;
+
+/**
+ * Functions are compiled to assembly by run_codegen.py, body of every
+ * direct_* function must be equal to body of invoke_* function with the same
+ * suffix. Methods aren't defined, so calls are left in assembly
+ */
+struct Sample {
+  int x{0};
+  int y{0};
+  static int total;
+  int add(int value);
+  int sum() const;
+  static int twice(int value);
+  IN_METAINFO(Sample)
+  REFLECT_OBJ_VAR(x)
+  REFLECT_OBJ_VAR(y)
+  REFLECT_STATIC_VAR(total)
+  REFLECT_OBJ_MTD(add, int)
+  REFLECT_CONST_OBJ_MTD(sum)
+  REFLECT_STATIC_MTD(twice, int)
+};
+
+#ifdef COUSOUS_STATELESS_METADATA
+// hana::tuple isn't std::is_empty, but tuple of empty elements has size 1
+static_assert(sizeof(reflect::utils::selected_metadata_t<Sample, Gen>) == 1,
+              "Stateless metadata must be empty");
+#endif
+
+extern "C" {
+
+int direct_var_read(const Sample &obj) { return obj.y; }
+
+int invoke_var_read(const Sample &obj) {
+  return reflect::utils::invoke<Sample, Gen>(hana::llong_c<1>, obj);
+}
+
+void direct_var_write(Sample &obj, int value) { obj.y = value; }
+
+void invoke_var_write(Sample &obj, int value) {
+  reflect::utils::invoke<Sample, Gen>(hana::llong_c<1>, obj) = value;
+}
+
+int direct_static_var() { return Sample::total; }
+
+int invoke_static_var() {
+  return reflect::utils::invoke<Sample, Gen>(hana::llong_c<2>);
+}
+
+int direct_method(Sample &obj, int value) { return obj.add(value); }
+
+int invoke_method(Sample &obj, int value) {
+  return reflect::utils::invoke<Sample, Gen>(hana::llong_c<3>, obj, value);
+}
+
+int direct_const_method(const Sample &obj) { return obj.sum(); }
+
+int invoke_const_method(const Sample &obj) {
+  return reflect::utils::invoke<Sample, Gen>(hana::llong_c<4>, obj);
+}
+
+int direct_static_method(int value) { return Sample::twice(value); }
+
+int invoke_static_method(int value) {
+  return reflect::utils::invoke<Sample, Gen>(hana::llong_c<5>, value);
+}
+}
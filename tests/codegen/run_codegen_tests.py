@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""Codegen tests of ideal couscous.
+
+Compiles codegen.cpp to assembly and checks that every invoke_* function has
+the same instructions as direct_* function with the same suffix, so reflected
+access is as cheap as direct member access. Stateless metadata
+(COUSOUS_STATELESS_METADATA) must match; default metadata is reported, but
+fails only with --strict.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+ROOT = os.path.dirname(os.path.abspath(__file__))
+SRC = os.path.normpath(os.path.join(ROOT, "..", "..", "src"))
+MAIN = os.path.join(ROOT, "codegen.cpp")
+
+PAIRS = ["var_read", "var_write", "static_var", "method", "const_method",
+         "static_method"]
+
+LABEL = re.compile(r"^_?([A-Za-z_][A-Za-z0-9_]*):")
+
+
+def compile_assembly(args, defines):
+    command = [args.cxx, "-std=" + args.std, "-I" + SRC, "-S", "-o", "-",
+               "-fno-asynchronous-unwind-tables", "-O" + args.opt]
+    command += ["-D" + define for define in defines] + args.cxxflags
+    command.append(MAIN)
+    process = subprocess.run(command, stdout=subprocess.PIPE,
+                             stderr=subprocess.PIPE, universal_newlines=True)
+    if process.returncode != 0:
+        sys.stderr.write(process.stderr)
+        return None
+    return process.stdout
+
+
+def functions(assembly):
+    """Splits assembly to instructions of direct_* and invoke_* functions.
+
+    Directives and local labels are dropped, so only instructions are
+    compared.
+    """
+    result = {}
+    current = None
+    for line in assembly.splitlines():
+        match = LABEL.match(line)
+        if match:
+            name = match.group(1)
+            current = name if name.startswith(("direct_", "invoke_")) \
+                else None
+            if current:
+                result[current] = []
+            continue
+        line = line.split("#")[0].strip()
+        if current is None or not line or line.startswith("."):
+            continue
+        result[current].append(" ".join(line.split()))
+    return result
+
+
+def check(args, mode, defines):
+    assembly = compile_assembly(args, defines)
+    if assembly is None:
+        print("%-10s compilation failed" % mode)
+        return False
+    bodies = functions(assembly)
+    ok = True
+    for pair in PAIRS:
+        direct = bodies.get("direct_" + pair)
+        invoke = bodies.get("invoke_" + pair)
+        same = direct is not None and direct == invoke
+        ok = ok and same
+        print("%-10s %-14s %s (%d/%d instructions)" % (
+            mode, pair, "same" if same else "DIFFERENT",
+            len(direct or []), len(invoke or [])))
+        if not same and args.verbose:
+            print("  direct: " + "; ".join(direct or []))
+            print("  invoke: " + "; ".join(invoke or []))
+    return ok
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "g++"),
+                        help="compiler (default: $CXX or g++)")
+    parser.add_argument("--std", default="c++17", help="language standard")
+    parser.add_argument("--opt", default="1",
+                        help="optimization level (0, 1, 2, 3, s)")
+    parser.add_argument("--strict", action="store_true",
+                        help="fail if default metadata differs too")
+    parser.add_argument("-v", "--verbose", action="store_true",
+                        help="print instructions of different functions")
+    parser.add_argument("--cxxflags", nargs=argparse.REMAINDER, default=[],
+                        help="additional compiler flags (must be last)")
+    args = parser.parse_args()
+    stateless = check(args, "stateless", ["COUSOUS_STATELESS_METADATA"])
+    default = check(args, "default", [])
+    return 0 if stateless and (default or not args.strict) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())